@@ -0,0 +1,168 @@
+/**
+ * @file LedAnimation.h
+ * @brief Formato das animações pré-codificadas em flash (geradas pelo tools/animpack)
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * A imagem guarda os frames já no formato do periférico de saída: o stream
+ * de símbolos do SPI (WS2812B) ou os duty cycles do PWM (LedController). Um
+ * keyframe é o stream completo, pronto para DMA direto da flash. Um frame
+ * delta traz só os trechos de LEDs que mudaram em relação ao frame anterior,
+ * também já codificados, para serem copiados sobre o buffer do driver.
+ *
+ * Layout (little endian, registros alinhados em 4 bytes):
+ *   LedAnimationHeader
+ *   por frame: LedAnimationRecord e então
+ *     keyframe: keyBytes bytes do stream completo
+ *     delta:    runs x (LedAnimationRun + count * ledBytes bytes)
+ *
+ * O primeiro frame é sempre um keyframe. Um delta sem trechos repete o
+ * frame anterior. Ao fim do último frame a animação volta ao primeiro.
+ *
+ * Não depende do core Arduino nem da libmaple, para ser usado também pelo
+ * empacotador no host.
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef __LED_ANIMATION_H__
+#define __LED_ANIMATION_H__
+
+#include <stdint.h>
+#include <string.h>
+
+#define LED_ANIMATION_VERSION       1
+#define LED_ANIMATION_ALIGN(n)      (((n) + 3) & ~3UL)
+
+enum LedAnimationFormat
+{
+    LED_ANIMATION_SPI = 0,  // Stream do WS2812B: preâmbulo, símbolos GRB e byte de cleardown
+    LED_ANIMATION_PWM = 1,  // Duty cycles de 16 bits do LedController, seguidos do reset
+};
+
+enum LedAnimationFrameType
+{
+    LED_ANIMATION_KEY = 0,
+    LED_ANIMATION_DELTA = 1,
+};
+
+struct LedAnimationHeader
+{
+    uint8_t magic[2];    // 'L', 'A'
+    uint8_t version;     // LED_ANIMATION_VERSION
+    uint8_t format;      // LedAnimationFormat
+    uint8_t symbolBits;  // SPI: bits por símbolo (WS2812B_SYMBOL_BITS); PWM: 0
+    uint8_t colorBytes;  // Bytes de cor por LED (3 = GRB, 4 = GRBW)
+    uint16_t leds;
+    uint16_t frames;
+    uint16_t frameMs;    // Intervalo entre frames
+    uint16_t ledBytes;   // Bytes codificados por LED
+    uint16_t keyOffset;  // Posição do LED 0 dentro de um keyframe (SPI: 1, após o preâmbulo)
+    uint32_t keyBytes;   // Bytes de um keyframe
+};
+
+struct LedAnimationRecord
+{
+    uint8_t type;        // LedAnimationFrameType
+    uint8_t reserved;
+    uint16_t runs;       // Delta: trechos alterados
+};
+
+struct LedAnimationRun
+{
+    uint16_t first;      // Primeiro LED do trecho
+    uint16_t count;      // LEDs do trecho (count * ledBytes bytes seguem)
+};
+
+/**
+ * @brief Um frame da imagem, apontando para os dados na flash
+ */
+struct LedAnimationFrame
+{
+    uint8_t type;
+    uint16_t runs;
+    const uint8_t* data; // Keyframe: stream completo; delta: primeiro trecho
+};
+
+/**
+ * @brief Percorre os frames de uma imagem em sequência, voltando ao início no fim
+ */
+class LedAnimationReader
+{
+public:
+    LedAnimationReader() : _image(nullptr), _offset(0), _frame(0) { memset(&_header, 0, sizeof(_header)); }
+
+    /**
+     * @brief Valida o cabeçalho e posiciona no primeiro frame
+     * @return false se a imagem não for uma animação desta versão
+     */
+    bool begin(const uint8_t* image)
+    {
+        _image = nullptr;
+        memcpy(&_header, image, sizeof(_header));
+        if (_header.magic[0] != 'L' || _header.magic[1] != 'A' ||
+            _header.version != LED_ANIMATION_VERSION || _header.frames == 0) {
+            return false;
+        }
+        _image = image;
+        rewind();
+        return true;
+    }
+
+    void rewind()
+    {
+        _offset = sizeof(LedAnimationHeader);
+        _frame = 0;
+    }
+
+    /**
+     * @brief Retorna o frame atual e avança para o seguinte
+     */
+    LedAnimationFrame next()
+    {
+        LedAnimationRecord record;
+        memcpy(&record, _image + _offset, sizeof(record));
+
+        LedAnimationFrame frame;
+        frame.type = record.type;
+        frame.runs = record.runs;
+        frame.data = _image + _offset + sizeof(record);
+
+        const uint8_t* end = frame.data;
+        if (record.type == LED_ANIMATION_KEY) {
+            end += LED_ANIMATION_ALIGN(_header.keyBytes);
+        } else {
+            for (uint16_t i = 0; i < record.runs; i++) {
+                LedAnimationRun run;
+                end = readRun(end, run);
+            }
+        }
+
+        _offset = end - _image;
+        if (++_frame >= _header.frames) rewind();
+        return frame;
+    }
+
+    /**
+     * @brief Lê o cabeçalho de um trecho de delta
+     * @param data Início do trecho
+     * @param run Recebe primeiro LED e quantidade; os dados codificados estão em data + sizeof(LedAnimationRun)
+     * @return Início do próximo trecho
+     */
+    const uint8_t* readRun(const uint8_t* data, LedAnimationRun& run) const
+    {
+        memcpy(&run, data, sizeof(run));
+        return data + sizeof(run) + LED_ANIMATION_ALIGN((uint32_t)run.count * _header.ledBytes);
+    }
+
+    const LedAnimationHeader& header() const { return _header; }
+    uint16_t frameIndex() const { return _frame; }
+
+private:
+    const uint8_t* _image;
+    LedAnimationHeader _header;
+    uint32_t _offset;
+    uint16_t _frame;   // Índice do próximo frame
+};
+
+#endif // __LED_ANIMATION_H__
@@ -0,0 +1,106 @@
+/**
+ * @file LedColor.cpp
+ * @brief Implementação dos kernels de cor independentes de hardware
+ * @version 1.0
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ */
+
+#include "LedColor.h"
+
+// h / 43
+const uint8_t LedColor::_hueRegion[256] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5
+};
+
+// (h - (h / 43) * 43) * 6
+const uint8_t LedColor::_hueRemainder[256] = {
+    0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 72, 78, 84, 90,
+    96, 102, 108, 114, 120, 126, 132, 138, 144, 150, 156, 162, 168, 174, 180, 186,
+    192, 198, 204, 210, 216, 222, 228, 234, 240, 246, 252, 0, 6, 12, 18, 24,
+    30, 36, 42, 48, 54, 60, 66, 72, 78, 84, 90, 96, 102, 108, 114, 120,
+    126, 132, 138, 144, 150, 156, 162, 168, 174, 180, 186, 192, 198, 204, 210, 216,
+    222, 228, 234, 240, 246, 252, 0, 6, 12, 18, 24, 30, 36, 42, 48, 54,
+    60, 66, 72, 78, 84, 90, 96, 102, 108, 114, 120, 126, 132, 138, 144, 150,
+    156, 162, 168, 174, 180, 186, 192, 198, 204, 210, 216, 222, 228, 234, 240, 246,
+    252, 0, 6, 12, 18, 24, 30, 36, 42, 48, 54, 60, 66, 72, 78, 84,
+    90, 96, 102, 108, 114, 120, 126, 132, 138, 144, 150, 156, 162, 168, 174, 180,
+    186, 192, 198, 204, 210, 216, 222, 228, 234, 240, 246, 252, 0, 6, 12, 18,
+    24, 30, 36, 42, 48, 54, 60, 66, 72, 78, 84, 90, 96, 102, 108, 114,
+    120, 126, 132, 138, 144, 150, 156, 162, 168, 174, 180, 186, 192, 198, 204, 210,
+    216, 222, 228, 234, 240, 246, 252, 0, 6, 12, 18, 24, 30, 36, 42, 48,
+    54, 60, 66, 72, 78, 84, 90, 96, 102, 108, 114, 120, 126, 132, 138, 144,
+    150, 156, 162, 168, 174, 180, 186, 192, 198, 204, 210, 216, 222, 228, 234, 240
+};
+
+Color LedColor::hsv(uint8_t h, uint8_t s, uint8_t v)
+{
+    Color c;
+    hsvSpan(&c, 1, h, 0, 1, s, v);
+    return c;
+}
+
+void LedColor::hsvSpan(Color* dest, uint16_t count, uint8_t startHue,
+                       uint16_t hueSpan, uint16_t steps, uint8_t s, uint8_t v,
+                       uint16_t first)
+{
+    if (s == 0) {
+        Color gray = ((uint32_t)v << 16) | ((uint32_t)v << 8) | v;
+        for (uint16_t i = 0; i < count; i++) {
+            dest[i] = gray;
+        }
+        return;
+    }
+    
+    // Passo inteiro e termo de erro do DDA: divisões só no início do trecho
+    uint16_t step = hueSpan / steps;
+    uint16_t error = hueSpan % steps;
+    uint32_t offset = (uint32_t)first * hueSpan;
+    uint16_t acc = offset % steps;
+    uint8_t hue = startHue + offset / steps;
+    
+    // p só depende de s e v
+    uint8_t p = (v * (255 - s)) >> 8;
+    
+    for (uint16_t i = 0; i < count; i++) {
+        uint8_t region = _hueRegion[hue];
+        uint8_t remainder = _hueRemainder[hue];
+        uint8_t q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+        uint8_t t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+        uint8_t r, g, b;
+        
+        switch (region) {
+            case 0:  r = v; g = t; b = p; break;
+            case 1:  r = q; g = v; b = p; break;
+            case 2:  r = p; g = v; b = t; break;
+            case 3:  r = p; g = q; b = v; break;
+            case 4:  r = t; g = p; b = v; break;
+            default: r = v; g = p; b = q; break;
+        }
+        dest[i] = ((uint32_t)r << 16) | ((uint32_t)g << 8) | b;
+        
+        // Avançar a matiz
+        hue += step;
+        acc += error;
+        if (acc >= steps) {
+            acc -= steps;
+            hue++;
+        }
+    }
+}
@@ -0,0 +1,62 @@
+/**
+ * @file LedColor.h
+ * @brief Kernels de cor independentes de hardware (HSV->RGB por tabela)
+ * @version 1.0
+ * @date 2026-10-18
+ * 
+ * Não depende do core Arduino nem da libmaple, para poder ser compilado e
+ * medido também no host.
+ * 
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef __LED_COLOR_H__
+#define __LED_COLOR_H__
+
+#include <stdint.h>
+
+// Cor empacotada em 32 bits
+typedef uint32_t Color;
+
+/**
+ * @brief Conversão HSV->RGB baseada em tabela
+ * 
+ * As tabelas guardam região (h / 43) e resto ((h % 43) * 6) de cada matiz,
+ * eliminando a divisão por pixel. O resultado é idêntico ao do
+ * LedController::ColorHSV original.
+ */
+class LedColor {
+public:
+    /**
+     * @brief Converte uma cor HSV para RGB empacotado
+     * @param h Matiz (0-255)
+     * @param s Saturação (0-255)
+     * @param v Valor/Brilho (0-255)
+     */
+    static Color hsv(uint8_t h, uint8_t s, uint8_t v);
+    
+    /**
+     * @brief Preenche um trecho com matizes igualmente espaçadas
+     * 
+     * A matiz do pixel k é startHue + floor((first + k) * hueSpan / steps),
+     * calculada incrementalmente (DDA com termo de erro), sem divisão por pixel.
+     * 
+     * @param dest Destino (count cores)
+     * @param count Quantidade de pixels
+     * @param startHue Matiz do primeiro pixel
+     * @param hueSpan Variação total de matiz ao longo de steps pixels (ex: 256)
+     * @param steps Número de pixels que cobrem hueSpan
+     * @param s Saturação
+     * @param v Valor
+     * @param first Posição do primeiro pixel na sequência (para continuar um trecho anterior)
+     */
+    static void hsvSpan(Color* dest, uint16_t count, uint8_t startHue,
+                        uint16_t hueSpan, uint16_t steps, uint8_t s, uint8_t v,
+                        uint16_t first = 0);
+
+private:
+    static const uint8_t _hueRegion[256];
+    static const uint8_t _hueRemainder[256];
+};
+
+#endif // __LED_COLOR_H__
@@ -9,47 +9,107 @@
 
 #include "LedController.h"
 #include <string.h>
+#include <Profiler.h>
 
 // ==================== Construtores/Destrutor ====================
 
 LedController::LedController(uint16_t numLeds) :
+    LedController(numLeds, nullptr, nullptr)
+{
+}
+
+LedController::LedController(const LedConfig& config) :
+    LedController(config, nullptr, nullptr)
+{
+}
+
+LedController::LedController(uint16_t numLeds, uint8_t* pixelBuffer, uint16_t* dmaBuffer) :
     _numLeds(numLeds),
     _brightness(255),
+    _frameBrightness(255),
     _begun(false),
-    _pixelBuffer(nullptr),
-    _dmaBuffer(nullptr),
+    _ownsBuffers(false),
+    _pixelBuffer(pixelBuffer),
+    _pixelBufferSize(0),
+    _ringOffset(0),
+    _dmaBuffer(dmaBuffer),
+    _dmaBufferSize(0),
+    _bufferBytesPerLed(pixelBuffer ? BYTES_PER_LED_RGB : 0),
+    _palette(nullptr),
+    _paletteUsage(nullptr),
+    _currentLimitMa(0),
+    _idleUaPerLed(LED_CURRENT_IDLE_UA),
+    _dirtyCount(0),
+    _dirtyBits(nullptr),
+    _allDirty(true),
+    _lastSentCount(0),
+    _sentBrightness(255),
+    _fullRefreshMs(LED_FULL_REFRESH_MS),
+    _lastFullRefresh(0),
     _lastShowTime(0)
 {
-    _config.numLeds = numLeds;
-    _config.pin = PA7;
-    _config.timer = TIMER3;
-    _config.timerChannel = 2;
-    _config.dma = DMA1;
-    _config.dmaChannel = DMA_CH3;  // TIM3_UP usa DMA1_CH3
-    _config.colorOrder = ORDER_GRB;
+    memset(_positionSum, 0, sizeof(_positionSum));
+    memset(_channelMa, LED_CURRENT_CHANNEL_MA, sizeof(_channelMa));
+    _setDefaultConfig(numLeds);
 }
 
-LedController::LedController(const LedConfig& config) :
+LedController::LedController(const LedConfig& config, uint8_t* pixelBuffer, uint16_t* dmaBuffer,
+                             uint8_t bufferBytesPerLed) :
     _config(config),
     _numLeds(config.numLeds),
     _brightness(255),
+    _frameBrightness(255),
     _begun(false),
-    _pixelBuffer(nullptr),
-    _dmaBuffer(nullptr),
+    _ownsBuffers(false),
+    _pixelBuffer(pixelBuffer),
+    _pixelBufferSize(0),
+    _ringOffset(0),
+    _dmaBuffer(dmaBuffer),
+    _dmaBufferSize(0),
+    _bufferBytesPerLed(pixelBuffer ? bufferBytesPerLed : 0),
+    _palette(nullptr),
+    _paletteUsage(nullptr),
+    _currentLimitMa(0),
+    _idleUaPerLed(LED_CURRENT_IDLE_UA),
+    _dirtyCount(0),
+    _dirtyBits(nullptr),
+    _allDirty(true),
+    _lastSentCount(0),
+    _sentBrightness(255),
+    _fullRefreshMs(LED_FULL_REFRESH_MS),
+    _lastFullRefresh(0),
     _lastShowTime(0)
 {
+    memset(_positionSum, 0, sizeof(_positionSum));
+    memset(_channelMa, LED_CURRENT_CHANNEL_MA, sizeof(_channelMa));
+}
+
+void LedController::_setDefaultConfig(uint16_t numLeds)
+{
+    _config.numLeds = numLeds;
+    _config.pin = PA7;
+    _config.timer = TIMER3;
+    _config.timerChannel = 2;
+    _config.dma = DMA1;
+    _config.dmaChannel = DMA_CH3;  // TIM3_UP usa DMA1_CH3
+    _config.colorOrder = ORDER_GRB;
+    _config.indexBits = 0;
 }
 
 LedController::~LedController()
 {
-    if (_pixelBuffer) {
+    if (_ownsBuffers) {
         free(_pixelBuffer);
-        _pixelBuffer = nullptr;
-    }
-    if (_dmaBuffer) {
         free(_dmaBuffer);
-        _dmaBuffer = nullptr;
+        free(_palette);
+        free(_paletteUsage);
+        free(_dirtyBits);
+        _palette = nullptr;
+        _paletteUsage = nullptr;
+        _dirtyBits = nullptr;
     }
+    _pixelBuffer = nullptr;
+    _dmaBuffer = nullptr;
     
     // Desabilitar DMA e Timer
     if (_begun) {
@@ -65,28 +125,67 @@ bool LedController::begin()
     if (_begun) return true;
     
     // Calcular tamanho dos buffers
-    uint8_t bytesPerLed = (_config.colorOrder == ORDER_GRBW || _config.colorOrder == ORDER_RGBW) 
-                          ? BYTES_PER_LED_RGBW : BYTES_PER_LED_RGB;
+    uint8_t bytesPerLed = _bytesPerLed();
     
-    _pixelBufferSize = _numLeds * bytesPerLed;
+    _pixelBufferSize = isIndexed() ? LED_CONTROLLER_INDEXED_BUFFER_SIZE(_numLeds, _config.indexBits)
+                                   : LED_CONTROLLER_PIXEL_BUFFER_SIZE(_numLeds, bytesPerLed);
     // Buffer DMA: bits por LED + reset pulses
-    _dmaBufferSize = (_numLeds * bytesPerLed * BITS_PER_BYTE) + WS2812_RESET_CYCLES;
+    _dmaBufferSize = LED_CONTROLLER_DMA_BUFFER_SIZE(_numLeds, bytesPerLed);
     
-    // Alocar buffer de pixels
-    _pixelBuffer = (uint8_t*)malloc(_pixelBufferSize);
-    if (!_pixelBuffer) {
-        return false;
+    if (_bufferBytesPerLed) {
+        // Buffers externos: apenas verificar se comportam a ordem de cores
+        if (bytesPerLed > _bufferBytesPerLed) {
+            return false;
+        }
+        if (isIndexed() && (!_palette || !_paletteUsage)) {
+            return false;
+        }
+    } else {
+        // Alocar buffer de pixels
+        _pixelBuffer = (uint8_t*)malloc(_pixelBufferSize);
+        if (!_pixelBuffer) {
+            return false;
+        }
+        
+        // Alocar buffer DMA (uint16_t para valores PWM)
+        _dmaBuffer = (uint16_t*)malloc(_dmaBufferSize * sizeof(uint16_t));
+        if (!_dmaBuffer) {
+            free(_pixelBuffer);
+            _pixelBuffer = nullptr;
+            return false;
+        }
+        
+        // Paleta e contadores de uso do modo indexado
+        if (isIndexed()) {
+            _palette = (Color*)malloc(_paletteSize() * sizeof(Color));
+            _paletteUsage = (uint16_t*)malloc(_paletteSize() * sizeof(uint16_t));
+            if (!_palette || !_paletteUsage) {
+                free(_pixelBuffer);
+                free(_dmaBuffer);
+                free(_palette);
+                free(_paletteUsage);
+                _pixelBuffer = nullptr;
+                _dmaBuffer = nullptr;
+                _palette = nullptr;
+                _paletteUsage = nullptr;
+                return false;
+            }
+        }
+        
+        // Sem memória para o bitmap a codificação volta a cobrir todo o prefixo
+        _dirtyBits = (uint32_t*)malloc(LED_CONTROLLER_DIRTY_WORDS(_numLeds) * sizeof(uint32_t));
+        _ownsBuffers = true;
     }
-    memset(_pixelBuffer, 0, _pixelBufferSize);
-    
-    // Alocar buffer DMA (uint16_t para valores PWM)
-    _dmaBuffer = (uint16_t*)malloc(_dmaBufferSize * sizeof(uint16_t));
-    if (!_dmaBuffer) {
-        free(_pixelBuffer);
-        _pixelBuffer = nullptr;
-        return false;
+    if (_dirtyBits) {
+        memset(_dirtyBits, 0, LED_CONTROLLER_DIRTY_WORDS(_numLeds) * sizeof(uint32_t));
+    }
+    if (isIndexed()) {
+        memset(_palette, 0, _paletteSize() * sizeof(Color));
     }
+    memset(_pixelBuffer, 0, _pixelBufferSize);
     memset(_dmaBuffer, 0, _dmaBufferSize * sizeof(uint16_t));
+    memset(_positionSum, 0, sizeof(_positionSum));
+    _markAllDirty();
     
     // Inicializar periféricos
     _initGPIO();
@@ -228,12 +327,74 @@ void LedController::show()
 {
     if (!_begun) return;
     
+    PROFILE_SCOPE("LedController::show");
+    
     // Aguardar tempo de reset
     while (!canShow()) { /* esperar */ }
     
+    // Brilho do frame limitado pelo orçamento de corrente
+    _frameBrightness = _limitBrightness();
+    if (_frameBrightness != _sentBrightness) _markAllDirty();
+    
+    // Enviar só até o maior LED alterado, com reenvio completo periódico
+    uint16_t count = _dirtyCount;
+    uint32_t now = millis();
+    if (_fullRefreshMs == 0 || now - _lastFullRefresh >= _fullRefreshMs) {
+        count = _numLeds;
+    }
+    _lastSentCount = count;
+    if (count == 0) return;
+    if (count == _numLeds) _lastFullRefresh = now;
+    
     // Codificar pixels para o buffer DMA
-    _encodePixels();
+    _encodePixels(count);
+    _dirtyCount = 0;
+    _sentBrightness = _frameBrightness;
     
+    // Após um prefixo, os zeros do reset cobrem a codificação dos LEDs seguintes: guardá-la e
+    // restaurá-la depois do envio (síncrono), para o buffer DMA continuar válido para showEncoded()
+    uint32_t length = (uint32_t)count * _bytesPerLed() * BITS_PER_BYTE;
+    uint16_t saved[WS2812_RESET_CYCLES];
+    memcpy(saved, _dmaBuffer + length, sizeof(saved));
+    memset(_dmaBuffer + length, 0, sizeof(saved));
+    
+    _transfer(_dmaBuffer, length + WS2812_RESET_CYCLES);
+    
+    memcpy(_dmaBuffer + length, saved, sizeof(saved));
+}
+
+void LedController::showEncoded(const uint16_t* slots, uint16_t count)
+{
+    if (!_begun) return;
+    
+    PROFILE_SCOPE("LedController::showEncoded");
+    
+    while (!canShow()) { /* esperar */ }
+    
+    if (count > _numLeds) count = _numLeds;
+    _lastSentCount = count;
+    _markAllDirty();
+    _transfer(slots, (uint32_t)count * _bytesPerLed() * BITS_PER_BYTE + WS2812_RESET_CYCLES);
+}
+
+void LedController::writeEncoded(uint16_t first, const uint16_t* slots, uint16_t count)
+{
+    if (!_begun || first >= _numLeds) return;
+    if (count > _numLeds - first) count = _numLeds - first;
+    
+    uint16_t slotsPerLed = _bytesPerLed() * BITS_PER_BYTE;
+    memcpy(_dmaBuffer + first * slotsPerLed, slots, (uint32_t)count * slotsPerLed * sizeof(uint16_t));
+    _markAllDirty();
+}
+
+void LedController::showEncoded()
+{
+    // O fim do buffer DMA guarda os zeros do reset, e show() restaura os LEDs cobertos pelo reset de um prefixo
+    showEncoded(_dmaBuffer, _numLeds);
+}
+
+void LedController::_transfer(const uint16_t* slots, uint32_t length)
+{
     // Obter ponteiro para registradores DMA
     dma_tube_reg_map* tube = dma_tube_regs(_config.dma, _config.dmaChannel);
     
@@ -244,9 +405,9 @@ void LedController::show()
     dma_clear_isr_bits(_config.dma, _config.dmaChannel);
     
     // Configurar DMA
-    tube->CMAR = (uint32_t)_dmaBuffer;
-    tube->CPAR = (uint32_t)_getTimerCCR();
-    tube->CNDTR = _dmaBufferSize;
+    tube->CMAR = (uint32_t)(uintptr_t)slots;
+    tube->CPAR = (uint32_t)(uintptr_t)_getTimerCCR();
+    tube->CNDTR = length;
     
     // CCR: PL=high, MSIZE=16bit, PSIZE=16bit, MINC=1, DIR=mem2periph, TCIE=1
     tube->CCR = DMA_CCR_PL_HIGH | DMA_CCR_MSIZE_16BITS | DMA_CCR_PSIZE_16BITS |
@@ -305,38 +466,92 @@ bool LedController::canShow()
 
 // ==================== Codificação ====================
 
-void LedController::_encodePixels()
+void LedController::_encodePixels(uint16_t count)
 {
+    PROFILE_SCOPE("LedController::_encodePixels");
+    
+    // O buffer DMA mantém a codificação do último frame: recodificar só os LEDs marcados
+    if (_dirtyBits && !_allDirty) {
+        _encodeDirty(count);
+        return;
+    }
+    if (_dirtyBits && count == _numLeds) {
+        memset(_dirtyBits, 0, LED_CONTROLLER_DIRTY_WORDS(_numLeds) * sizeof(uint32_t));
+        _allDirty = false;
+    }
+    
     uint16_t* dmaPtr = _dmaBuffer;
-    uint8_t bytesPerLed = (_config.colorOrder == ORDER_GRBW || _config.colorOrder == ORDER_RGBW) 
-                          ? BYTES_PER_LED_RGBW : BYTES_PER_LED_RGB;
     
-    for (uint16_t i = 0; i < _numLeds; i++) {
-        uint8_t* pixel = &_pixelBuffer[i * bytesPerLed];
+    // O LED lógico 0 está na posição física _ringOffset: os count primeiros LEDs
+    // lógicos podem dar a volta no fim do anel
+    uint32_t end = (uint32_t)_ringOffset + count;
+    if (end <= _numLeds) {
+        _encodeRange(_ringOffset, end, dmaPtr);
+    } else {
+        _encodeRange(_ringOffset, _numLeds, dmaPtr);
+        _encodeRange(0, end - _numLeds, dmaPtr);
+    }
+}
+
+void LedController::_encodeDirty(uint16_t count)
+{
+    uint16_t slotsPerLed = _bytesPerLed() * BITS_PER_BYTE;
+    uint16_t words = LED_CONTROLLER_DIRTY_WORDS(count);
+    
+    for (uint16_t w = 0; w < words; w++) {
+        uint32_t bits = _dirtyBits[w];
+        if (!bits) continue;
+        
+        // LEDs além do prefixo enviado continuam marcados
+        if (w == words - 1 && (count & 31)) bits &= (1UL << (count & 31)) - 1;
+        _dirtyBits[w] &= ~bits;
+        
+        while (bits) {
+            uint16_t index = w * 32 + __builtin_ctz(bits);
+            bits &= bits - 1;
+            uint16_t physical = _physicalIndex(index);
+            uint16_t* dmaPtr = _dmaBuffer + index * slotsPerLed;
+            _encodeRange(physical, physical + 1, dmaPtr);
+        }
+    }
+}
+
+void LedController::_encodeRange(uint16_t start, uint16_t end, uint16_t*& dmaPtr)
+{
+    uint8_t bytesPerLed = _bytesPerLed();
+    
+    for (uint16_t i = start; i < end; i++) {
         uint8_t r, g, b, w = 0;
         
-        // Extrair componentes do buffer (já está na ordem correta)
-        switch (_config.colorOrder) {
-            case ORDER_GRB:
-                g = pixel[0]; r = pixel[1]; b = pixel[2];
-                break;
-            case ORDER_RGB:
-                r = pixel[0]; g = pixel[1]; b = pixel[2];
-                break;
-            case ORDER_BRG:
-                b = pixel[0]; r = pixel[1]; g = pixel[2];
-                break;
-            case ORDER_BGR:
-                b = pixel[0]; g = pixel[1]; r = pixel[2];
-                break;
-            case ORDER_GRBW:
-                g = pixel[0]; r = pixel[1]; b = pixel[2]; w = pixel[3];
-                break;
-            case ORDER_RGBW:
-                r = pixel[0]; g = pixel[1]; b = pixel[2]; w = pixel[3];
-                break;
-            default:
-                g = pixel[0]; r = pixel[1]; b = pixel[2];
+        if (isIndexed()) {
+            // Expandir o índice pela paleta
+            Color c = _palette[_readIndex(i)];
+            w = (c >> 24) & 0xFF; r = (c >> 16) & 0xFF; g = (c >> 8) & 0xFF; b = c & 0xFF;
+        } else {
+            uint8_t* pixel = &_pixelBuffer[i * bytesPerLed];
+            // Extrair componentes do buffer (já está na ordem correta)
+            switch (_config.colorOrder) {
+                case ORDER_GRB:
+                    g = pixel[0]; r = pixel[1]; b = pixel[2];
+                    break;
+                case ORDER_RGB:
+                    r = pixel[0]; g = pixel[1]; b = pixel[2];
+                    break;
+                case ORDER_BRG:
+                    b = pixel[0]; r = pixel[1]; g = pixel[2];
+                    break;
+                case ORDER_BGR:
+                    b = pixel[0]; g = pixel[1]; r = pixel[2];
+                    break;
+                case ORDER_GRBW:
+                    g = pixel[0]; r = pixel[1]; b = pixel[2]; w = pixel[3];
+                    break;
+                case ORDER_RGBW:
+                    r = pixel[0]; g = pixel[1]; b = pixel[2]; w = pixel[3];
+                    break;
+                default:
+                    g = pixel[0]; r = pixel[1]; b = pixel[2];
+            }
         }
         
         // Aplicar brilho
@@ -354,29 +569,31 @@ void LedController::_encodePixels()
             _encodeByte(w, dmaPtr); dmaPtr += 8;
         }
     }
-    
-    // Adicionar período de reset (valores 0)
-    for (uint16_t i = 0; i < WS2812_RESET_CYCLES; i++) {
-        *dmaPtr++ = 0;
-    }
 }
 
 void LedController::_encodeByte(uint8_t byte, uint16_t* dest)
 {
-    // Codificar 8 bits, MSB primeiro
-    for (int8_t bit = 7; bit >= 0; bit--) {
-        if (byte & (1 << bit)) {
-            *dest++ = WS2812_PWM_HIGH;  // Bit 1: duty cycle alto
-        } else {
-            *dest++ = WS2812_PWM_LOW;   // Bit 0: duty cycle baixo
-        }
-    }
+    ledPwmEncodeByte(byte, dest);
 }
 
 uint8_t LedController::_applyBrightness(uint8_t value)
 {
-    if (_brightness == 255) return value;
-    return (uint16_t)value * _brightness / 255;
+    if (_frameBrightness == 255) return value;
+    return (uint16_t)value * _frameBrightness / 255;
+}
+
+uint8_t LedController::_bytesPerLed() const
+{
+    return (_config.colorOrder == ORDER_GRBW || _config.colorOrder == ORDER_RGBW) 
+           ? BYTES_PER_LED_RGBW : BYTES_PER_LED_RGB;
+}
+
+uint16_t LedController::_physicalIndex(uint16_t index) const
+{
+    // index < _numLeds e _ringOffset < _numLeds: uma subtração substitui o módulo
+    uint32_t physical = (uint32_t)index + _ringOffset;
+    if (physical >= _numLeds) physical -= _numLeds;
+    return physical;
 }
 
 // ==================== Métodos de Cor ====================
@@ -385,9 +602,18 @@ void LedController::setPixelColor(uint16_t index, uint8_t r, uint8_t g, uint8_t
 {
     if (index >= _numLeds || !_pixelBuffer) return;
     
-    uint8_t bytesPerLed = (_config.colorOrder == ORDER_GRBW || _config.colorOrder == ORDER_RGBW) 
-                          ? BYTES_PER_LED_RGBW : BYTES_PER_LED_RGB;
-    uint8_t* pixel = &_pixelBuffer[index * bytesPerLed];
+    if (isIndexed()) {
+        setPixelIndex(index, _paletteIndexFor(Color_RGB(r, g, b)));
+        return;
+    }
+    
+    uint8_t* pixel = &_pixelBuffer[_physicalIndex(index) * _bytesPerLed()];
+    
+    // Somas por posição: retirar a cor antiga antes de sobrescrever
+    uint8_t old0 = pixel[0], old1 = pixel[1], old2 = pixel[2];
+    _positionSum[0] -= old0;
+    _positionSum[1] -= old1;
+    _positionSum[2] -= old2;
     
     // Armazenar na ordem GRB (padrão WS2812B)
     switch (_config.colorOrder) {
@@ -408,18 +634,34 @@ void LedController::setPixelColor(uint16_t index, uint8_t r, uint8_t g, uint8_t
         default:
             pixel[0] = g; pixel[1] = r; pixel[2] = b;
     }
+    
+    _positionSum[0] += pixel[0];
+    _positionSum[1] += pixel[1];
+    _positionSum[2] += pixel[2];
+    
+    if (pixel[0] != old0 || pixel[1] != old1 || pixel[2] != old2) {
+        _markDirty(index);
+    }
 }
 
 void LedController::setPixelColor(uint16_t index, uint8_t r, uint8_t g, uint8_t b, uint8_t w)
 {
     if (index >= _numLeds || !_pixelBuffer) return;
     
+    if (isIndexed()) {
+        setPixelIndex(index, _paletteIndexFor(Color_RGBW(r, g, b, w)));
+        return;
+    }
+    
     setPixelColor(index, r, g, b);
     
     // Se for RGBW, adicionar componente W
     if (_config.colorOrder == ORDER_GRBW || _config.colorOrder == ORDER_RGBW) {
-        uint8_t* pixel = &_pixelBuffer[index * BYTES_PER_LED_RGBW];
+        uint8_t* pixel = &_pixelBuffer[_physicalIndex(index) * BYTES_PER_LED_RGBW];
+        if (pixel[3] != w) _markDirty(index);
+        _positionSum[3] -= pixel[3];
         pixel[3] = w;
+        _positionSum[3] += w;
     }
 }
 
@@ -437,9 +679,11 @@ Color LedController::getPixelColor(uint16_t index)
 {
     if (index >= _numLeds || !_pixelBuffer) return 0;
     
-    uint8_t bytesPerLed = (_config.colorOrder == ORDER_GRBW || _config.colorOrder == ORDER_RGBW) 
-                          ? BYTES_PER_LED_RGBW : BYTES_PER_LED_RGB;
-    uint8_t* pixel = &_pixelBuffer[index * bytesPerLed];
+    if (isIndexed()) {
+        return _palette[_readIndex(_physicalIndex(index))];
+    }
+    
+    uint8_t* pixel = &_pixelBuffer[_physicalIndex(index) * _bytesPerLed()];
     
     uint8_t r, g, b, w = 0;
     
@@ -498,6 +742,15 @@ void LedController::clear()
     if (_pixelBuffer) {
         memset(_pixelBuffer, 0, _pixelBufferSize);
     }
+    memset(_positionSum, 0, sizeof(_positionSum));
+    if (isIndexed() && _paletteUsage) {
+        // Todos os LEDs no índice 0, que volta a ser preto
+        memset(_paletteUsage, 0, _paletteSize() * sizeof(uint16_t));
+        _paletteUsage[0] = _numLeds;
+        _palette[0] = 0;
+    }
+    _ringOffset = 0;
+    _markAllDirty();
 }
 
 void LedController::setBrightness(uint8_t brightness)
@@ -510,6 +763,194 @@ uint8_t LedController::getBrightness() const
     return _brightness;
 }
 
+// ==================== Modo indexado ====================
+
+bool LedController::setIndexedMode(uint8_t indexBits)
+{
+    if (_begun || (indexBits != 0 && indexBits != 4 && indexBits != 8)) return false;
+    _config.indexBits = indexBits;
+    return true;
+}
+
+uint8_t LedController::_readIndex(uint16_t physical) const
+{
+    if (_config.indexBits == 8) return _pixelBuffer[physical];
+    uint8_t byte = _pixelBuffer[physical >> 1];
+    return (physical & 1) ? byte & 0x0F : byte >> 4;
+}
+
+void LedController::_writeIndex(uint16_t physical, uint8_t value)
+{
+    if (_config.indexBits == 8) {
+        _pixelBuffer[physical] = value;
+        return;
+    }
+    uint8_t* byte = &_pixelBuffer[physical >> 1];
+    *byte = (physical & 1) ? (*byte & 0xF0) | value : (*byte & 0x0F) | (value << 4);
+}
+
+void LedController::setPixelIndex(uint16_t index, uint8_t paletteIndex)
+{
+    if (index >= _numLeds || !_pixelBuffer || !isIndexed() || paletteIndex >= _paletteSize()) return;
+    
+    uint16_t physical = _physicalIndex(index);
+    uint8_t old = _readIndex(physical);
+    if (old == paletteIndex) return;
+    
+    _paletteUsage[old]--;
+    _paletteUsage[paletteIndex]++;
+    _writeIndex(physical, paletteIndex);
+    _markDirty(index);
+}
+
+uint8_t LedController::getPixelIndex(uint16_t index)
+{
+    if (index >= _numLeds || !_pixelBuffer || !isIndexed()) return 0;
+    return _readIndex(_physicalIndex(index));
+}
+
+void LedController::setPaletteColor(uint8_t paletteIndex, Color color)
+{
+    if (!_palette || paletteIndex >= _paletteSize() || _palette[paletteIndex] == color) return;
+    
+    _palette[paletteIndex] = color;
+    // Os LEDs com esse índice podem estar em qualquer posição
+    if (_paletteUsage[paletteIndex] > 0) _markAllDirty();
+}
+
+Color LedController::getPaletteColor(uint8_t paletteIndex) const
+{
+    if (!_palette || paletteIndex >= _paletteSize()) return 0;
+    return _palette[paletteIndex];
+}
+
+uint8_t LedController::_paletteIndexFor(Color color)
+{
+    uint16_t size = _paletteSize();
+    int16_t unused = -1;
+    
+    for (uint16_t i = 0; i < size; i++) {
+        if (_palette[i] == color) return i;
+        if (unused < 0 && _paletteUsage[i] == 0) unused = i;
+    }
+    
+    // Cor nova: ocupar uma entrada sem LEDs
+    if (unused >= 0) {
+        _palette[unused] = color;
+        return unused;
+    }
+    
+    // Paleta cheia: cor mais próxima (distância quadrática por canal)
+    uint8_t best = 0;
+    uint32_t bestDistance = 0xFFFFFFFF;
+    for (uint16_t i = 0; i < size; i++) {
+        uint32_t distance = 0;
+        for (uint8_t shift = 0; shift < 32; shift += 8) {
+            int16_t d = (int16_t)((color >> shift) & 0xFF) - (int16_t)((_palette[i] >> shift) & 0xFF);
+            distance += d * d;
+        }
+        if (distance < bestDistance) {
+            bestDistance = distance;
+            best = i;
+        }
+    }
+    return best;
+}
+
+// ==================== Limitador de corrente ====================
+
+void LedController::setCurrentLimit(uint32_t milliamps)
+{
+    _currentLimitMa = milliamps;
+}
+
+void LedController::setCurrentCoefficients(uint8_t redMa, uint8_t greenMa, uint8_t blueMa,
+                                           uint8_t whiteMa, uint16_t idleUa)
+{
+    _channelMa[0] = redMa;
+    _channelMa[1] = greenMa;
+    _channelMa[2] = blueMa;
+    _channelMa[3] = whiteMa;
+    _idleUaPerLed = idleUa;
+}
+
+uint32_t LedController::estimateCurrent() const
+{
+    uint32_t idleUa = (uint32_t)_idleUaPerLed * _numLeds;
+    uint32_t dynamicUa = _dynamicCurrentUa();
+    return (idleUa + (uint64_t)dynamicUa * _brightness / 255) / 1000;
+}
+
+uint32_t LedController::_dynamicCurrentUa() const
+{
+    if (isIndexed()) {
+        // Consumo de cada cor da paleta vezes a quantidade de LEDs que a usam
+        uint64_t total = 0;
+        for (uint16_t i = 0; i < _paletteSize(); i++) {
+            if (_paletteUsage[i] == 0) continue;
+            Color c = _palette[i];
+            uint32_t perLed = ((c >> 16) & 0xFF) * _channelMa[0] + ((c >> 8) & 0xFF) * _channelMa[1] +
+                              (c & 0xFF) * _channelMa[2];
+            if (_bytesPerLed() == BYTES_PER_LED_RGBW) perLed += ((c >> 24) & 0xFF) * _channelMa[3];
+            total += (uint64_t)perLed * _paletteUsage[i];
+        }
+        return (uint32_t)(total * 1000 / 255);
+    }
+    
+    // Canal (R, G, B, W) armazenado em cada posição do pixel
+    static const uint8_t R = 0, G = 1, B = 2, W = 3;
+    uint8_t channel[BYTES_PER_LED_RGBW];
+    switch (_config.colorOrder) {
+        case ORDER_RGB:
+        case ORDER_RGBW:
+            channel[0] = R; channel[1] = G; channel[2] = B;
+            break;
+        case ORDER_BRG:
+            channel[0] = B; channel[1] = R; channel[2] = G;
+            break;
+        case ORDER_BGR:
+            channel[0] = B; channel[1] = G; channel[2] = R;
+            break;
+        default:
+            channel[0] = G; channel[1] = R; channel[2] = B;
+    }
+    channel[3] = W;
+    
+    // Soma de bytes * mA / 255 = corrente em mA com brilho máximo; calcular em uA
+    uint64_t total = 0;
+    for (uint8_t i = 0; i < _bytesPerLed(); i++) {
+        total += (uint64_t)_positionSum[i] * _channelMa[channel[i]];
+    }
+    return (uint32_t)(total * 1000 / 255);
+}
+
+uint8_t LedController::_limitBrightness() const
+{
+    if (_currentLimitMa == 0) return _brightness;
+    
+    uint32_t limitUa = _currentLimitMa * 1000;
+    uint32_t idleUa = (uint32_t)_idleUaPerLed * _numLeds;
+    if (limitUa <= idleUa) return 0;
+    
+    uint32_t dynamicUa = _dynamicCurrentUa();
+    if ((uint64_t)dynamicUa * _brightness <= (uint64_t)(limitUa - idleUa) * 255) {
+        return _brightness;
+    }
+    
+    // Maior brilho cujo consumo dinâmico cabe no que sobra do orçamento
+    return (uint8_t)((uint64_t)(limitUa - idleUa) * 255 / dynamicUa);
+}
+
+void LedController::_subtractSums(const uint8_t* pixel, uint16_t count)
+{
+    uint8_t bytesPerLed = _bytesPerLed();
+    for (uint16_t i = 0; i < count; i++, pixel += bytesPerLed) {
+        for (uint8_t j = 0; j < bytesPerLed; j++) {
+            _positionSum[j] -= pixel[j];
+        }
+    }
+}
+
 // ==================== Métodos Estáticos de Cor ====================
 
 Color LedController::Color_RGB(uint8_t r, uint8_t g, uint8_t b)
@@ -524,29 +965,7 @@ Color LedController::Color_RGBW(uint8_t r, uint8_t g, uint8_t b, uint8_t w)
 
 Color LedController::ColorHSV(uint8_t h, uint8_t s, uint8_t v)
 {
-    uint8_t r, g, b;
-    
-    if (s == 0) {
-        r = g = b = v;
-    } else {
-        uint8_t region = h / 43;
-        uint8_t remainder = (h - (region * 43)) * 6;
-        
-        uint8_t p = (v * (255 - s)) >> 8;
-        uint8_t q = (v * (255 - ((s * remainder) >> 8))) >> 8;
-        uint8_t t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
-        
-        switch (region) {
-            case 0:  r = v; g = t; b = p; break;
-            case 1:  r = q; g = v; b = p; break;
-            case 2:  r = p; g = v; b = t; break;
-            case 3:  r = p; g = q; b = v; break;
-            case 4:  r = t; g = p; b = v; break;
-            default: r = v; g = p; b = q; break;
-        }
-    }
-    
-    return Color_RGB(r, g, b);
+    return LedColor::hsv(h, s, v);
 }
 
 Color LedController::blend(Color color1, Color color2, uint8_t amount)
@@ -570,9 +989,18 @@ Color LedController::blend(Color color1, Color color2, uint8_t amount)
 
 void LedController::rainbow(uint8_t startHue)
 {
-    for (uint16_t i = 0; i < _numLeds; i++) {
-        uint8_t hue = startHue + (i * 256 / _numLeds);
-        setPixelColor(i, ColorHSV(hue, 255, 255));
+    // Blocos pequenos na pilha; cada bloco retoma o DDA do ponto onde o anterior parou
+    const uint16_t chunk = 16;
+    Color colors[chunk];
+    
+    for (uint16_t i = 0; i < _numLeds; i += chunk) {
+        uint16_t count = _numLeds - i < chunk ? _numLeds - i : chunk;
+        
+        LedColor::hsvSpan(colors, count, startHue, 256, _numLeds, 255, 255, i);
+        
+        for (uint16_t k = 0; k < count; k++) {
+            setPixelColor(i + k, colors[k]);
+        }
     }
 }
 
@@ -580,54 +1008,60 @@ void LedController::rotate(int16_t positions)
 {
     if (_numLeds < 2 || !_pixelBuffer) return;
     
-    uint8_t bytesPerLed = (_config.colorOrder == ORDER_GRBW || _config.colorOrder == ORDER_RGBW) 
-                          ? BYTES_PER_LED_RGBW : BYTES_PER_LED_RGB;
-    
     // Normalizar posições
     positions = positions % (int16_t)_numLeds;
     if (positions < 0) positions += _numLeds;
     if (positions == 0) return;
     
-    // Usar buffer temporário
-    uint8_t* temp = (uint8_t*)malloc(_pixelBufferSize);
-    if (!temp) return;
-    
-    // Copiar rotacionado
-    for (uint16_t i = 0; i < _numLeds; i++) {
-        uint16_t srcIndex = (i + positions) % _numLeds;
-        memcpy(&temp[i * bytesPerLed], &_pixelBuffer[srcIndex * bytesPerLed], bytesPerLed);
-    }
-    
-    // Copiar de volta
-    memcpy(_pixelBuffer, temp, _pixelBufferSize);
-    free(temp);
+    // O LED lógico i passa a mostrar o antigo LED lógico i + positions
+    _ringOffset = _physicalIndex(positions);
+    _markAllDirty();
 }
 
 void LedController::shift(int16_t positions)
 {
     if (_numLeds < 2 || !_pixelBuffer || positions == 0) return;
     
-    uint8_t bytesPerLed = (_config.colorOrder == ORDER_GRBW || _config.colorOrder == ORDER_RGBW) 
-                          ? BYTES_PER_LED_RGBW : BYTES_PER_LED_RGB;
+    uint16_t count = positions > 0 ? positions : -positions;
+    if (count >= _numLeds) {
+        clear();
+        return;
+    }
     
     if (positions > 0) {
-        // Shift para direita
-        for (int16_t i = _numLeds - 1; i >= positions; i--) {
-            memcpy(&_pixelBuffer[i * bytesPerLed], 
-                   &_pixelBuffer[(i - positions) * bytesPerLed], 
-                   bytesPerLed);
-        }
-        // Limpar LEDs iniciais
-        memset(_pixelBuffer, 0, positions * bytesPerLed);
+        // Shift para direita: rotacionar e limpar LEDs iniciais
+        rotate(-positions);
+        _clearRange(0, count);
     } else {
-        // Shift para esquerda
-        positions = -positions;
-        for (uint16_t i = 0; i < _numLeds - positions; i++) {
-            memcpy(&_pixelBuffer[i * bytesPerLed], 
-                   &_pixelBuffer[(i + positions) * bytesPerLed], 
-                   bytesPerLed);
+        // Shift para esquerda: rotacionar e limpar LEDs finais
+        rotate(count);
+        _clearRange(_numLeds - count, count);
+    }
+}
+
+void LedController::_clearRange(uint16_t startIndex, uint16_t count)
+{
+    if (isIndexed()) {
+        uint8_t black = _paletteIndexFor(0);
+        for (uint16_t i = 0; i < count; i++) {
+            setPixelIndex(startIndex + i, black);
         }
-        // Limpar LEDs finais
-        memset(&_pixelBuffer[(_numLeds - positions) * bytesPerLed], 0, positions * bytesPerLed);
+        return;
+    }
+    
+    uint8_t bytesPerLed = _bytesPerLed();
+    uint16_t physical = _physicalIndex(startIndex);
+    
+    // A faixa lógica pode dar a volta no fim do buffer físico
+    uint16_t first = _numLeds - physical;
+    if (first > count) first = count;
+    
+    _subtractSums(&_pixelBuffer[physical * bytesPerLed], first);
+    _subtractSums(_pixelBuffer, count - first);
+    
+    memset(&_pixelBuffer[physical * bytesPerLed], 0, first * bytesPerLed);
+    memset(_pixelBuffer, 0, (count - first) * bytesPerLed);
+    for (uint16_t i = 0; i < count; i++) {
+        _markDirty(startIndex + i);
     }
 }
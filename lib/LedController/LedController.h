@@ -26,20 +26,22 @@
 #include <libmaple/rcc.h>
 #include <libmaple/gpio.h>
 
-// Configurações de timing para WS2812B @ 72MHz
-// Período PWM = 90 ciclos = 1.25us @ 72MHz (800kHz)
-#define WS2812_PWM_PERIOD       90
-#define WS2812_PWM_HIGH         58      // ~0.8us para bit 1
-#define WS2812_PWM_LOW          29      // ~0.4us para bit 0
-#define WS2812_RESET_CYCLES     50      // Ciclos de reset (>50us)
+#include "LedColor.h"
+#include "LedPwmEncoding.h"
 
-// Bytes por LED (GRB = 3 bytes, GRBW = 4 bytes)
-#define BYTES_PER_LED_RGB       3
-#define BYTES_PER_LED_RGBW      4
-#define BITS_PER_BYTE           8
+// Intervalo do reenvio completo da fita quando apenas um prefixo muda
+#ifndef LED_FULL_REFRESH_MS
+#define LED_FULL_REFRESH_MS 1000
+#endif
+
+// Consumo típico de um WS2812B por canal em 255 e em repouso
+#ifndef LED_CURRENT_CHANNEL_MA
+#define LED_CURRENT_CHANNEL_MA 20
+#endif
+#ifndef LED_CURRENT_IDLE_UA
+#define LED_CURRENT_IDLE_UA 1000
+#endif
 
-// Cor empacotada em 32 bits
-typedef uint32_t Color;
 
 /**
  * @brief Enumeração para ordem de cores
@@ -64,6 +66,7 @@ struct LedConfig {
     dma_dev* dma;               // DMA device (DMA1)
     dma_channel dmaChannel;     // Canal DMA
     ColorOrder colorOrder;      // Ordem das cores
+    uint8_t indexBits;          // Bits por LED no modo indexado (4 ou 8, 0 = cor direta)
     
     // Construtor com valores padrão para pino PA0 (TIM2_CH1)
     LedConfig() : 
@@ -73,7 +76,8 @@ struct LedConfig {
         timerChannel(1),
         dma(DMA1),
         dmaChannel(DMA_CH2),  // TIM2_CH1 usa DMA1_CH2
-        colorOrder(ORDER_GRB) {}
+        colorOrder(ORDER_GRB),
+        indexBits(0) {}
 };
 
 /**
@@ -93,6 +97,25 @@ public:
      */
     LedController(const LedConfig& config);
     
+    /**
+     * @brief Construtor com buffers fornecidos pelo chamador (sem alocação)
+     * @param numLeds Número de LEDs na fita
+     * @param pixelBuffer LED_CONTROLLER_PIXEL_BUFFER_SIZE(numLeds, 3) bytes
+     * @param dmaBuffer LED_CONTROLLER_DMA_BUFFER_SIZE(numLeds, 3) valores
+     */
+    LedController(uint16_t numLeds, uint8_t* pixelBuffer, uint16_t* dmaBuffer);
+    
+    /**
+     * @brief Construtor com configuração completa e buffers fornecidos pelo chamador
+     * @param config Estrutura de configuração
+     * @param pixelBuffer LED_CONTROLLER_PIXEL_BUFFER_SIZE(numLeds, bufferBytesPerLed) bytes
+     * @param dmaBuffer LED_CONTROLLER_DMA_BUFFER_SIZE(numLeds, bufferBytesPerLed) valores
+     * @param bufferBytesPerLed Bytes por LED para os quais os buffers foram dimensionados;
+     *        begin() falha se a ordem de cores da configuração precisar de mais
+     */
+    LedController(const LedConfig& config, uint8_t* pixelBuffer, uint16_t* dmaBuffer,
+                  uint8_t bufferBytesPerLed = BYTES_PER_LED_RGB);
+    
     /**
      * @brief Destrutor
      */
@@ -100,15 +123,50 @@ public:
     
     /**
      * @brief Inicializa o controlador
+     * 
+     * Com buffers externos nada é alocado; falha se a ordem de cores exigir
+     * mais bytes por LED do que os buffers comportam.
+     * 
      * @return true se inicializado com sucesso
      */
     bool begin();
     
     /**
      * @brief Envia os dados para os LEDs
+     * 
+     * Envia apenas os LEDs até o maior índice alterado desde o último envio
+     * (nada, se nenhum mudou), seguido do reset.
      */
     void show();
     
+    /**
+     * @brief Envia um frame já codificado em duty cycles, sem passar pelo buffer DMA
+     * 
+     * Usado para keyframes de animação guardados na flash: o DMA lê direto de
+     * slots. Brilho e limitador de corrente não são aplicados. A fita deixa de
+     * mostrar o buffer de pixels, então o próximo show() recodifica tudo.
+     * 
+     * @param slots count * bytesPerLed * 8 valores seguidos de WS2812_RESET_CYCLES zeros
+     * @param count LEDs do frame (limitado ao tamanho da fita)
+     */
+    void showEncoded(const uint16_t* slots, uint16_t count);
+    
+    /**
+     * @brief Copia LEDs já codificados para o buffer DMA, a partir da posição first da fita
+     * 
+     * Para aplicar os trechos de um frame delta sobre o frame anterior; o
+     * resultado é enviado com showEncoded(). O buffer DMA deixa de refletir o
+     * buffer de pixels, então o próximo show() recodifica tudo.
+     * 
+     * @param slots count * bytesPerLed * 8 valores
+     */
+    void writeEncoded(uint16_t first, const uint16_t* slots, uint16_t count);
+    
+    /**
+     * @brief Envia o buffer DMA como está (após writeEncoded())
+     */
+    void showEncoded();
+    
     /**
      * @brief Verifica se uma transmissão DMA está em andamento
      * @return true se ocupado
@@ -124,6 +182,10 @@ public:
     
     /**
      * @brief Define a cor de um LED específico
+     * 
+     * No modo indexado usa a entrada da paleta com a mesma cor, ocupa uma
+     * entrada sem uso ou, com a paleta cheia, usa a cor mais próxima.
+     * 
      * @param index Índice do LED (0 a numLeds-1)
      * @param r Componente vermelho (0-255)
      * @param g Componente verde (0-255)
@@ -194,6 +256,77 @@ public:
      */
     uint8_t getBrightness() const;
     
+    // ==================== Modo indexado ====================
+    
+    /**
+     * @brief Ativa o modo de cor indexada (chamar antes de begin())
+     * 
+     * Cada LED guarda 4 ou 8 bits de índice em uma paleta de 16 ou 256 cores,
+     * em vez de 3-4 bytes. Os índices são expandidos na codificação.
+     * clear() leva todos os LEDs ao índice 0 e o redefine como preto.
+     * 
+     * @param indexBits 4 ou 8 (0 = cor direta)
+     * @return false se já iniciado ou se indexBits for inválido
+     */
+    bool setIndexedMode(uint8_t indexBits);
+    
+    bool isIndexed() const { return _config.indexBits != 0; }
+    
+    /**
+     * @brief Define o índice de paleta de um LED
+     */
+    void setPixelIndex(uint16_t index, uint8_t paletteIndex);
+    
+    uint8_t getPixelIndex(uint16_t index);
+    
+    /**
+     * @brief Altera uma cor da paleta
+     * 
+     * Todos os LEDs com esse índice mudam de cor no próximo show(), com uma
+     * única escrita na tabela.
+     */
+    void setPaletteColor(uint8_t paletteIndex, Color color);
+    
+    Color getPaletteColor(uint8_t paletteIndex) const;
+    
+    // ==================== Limitador de corrente ====================
+    
+    /**
+     * @brief Define o orçamento de corrente da fita
+     * 
+     * Se a corrente estimada do frame passar do limite, o brilho é reduzido
+     * apenas para aquele frame durante a codificação em show().
+     * 
+     * @param milliamps Limite em mA (0 = desabilitado)
+     */
+    void setCurrentLimit(uint32_t milliamps);
+    
+    /**
+     * @brief Define o consumo de cada canal em 255 e o consumo em repouso por LED
+     * @param redMa Corrente do vermelho em mA
+     * @param greenMa Corrente do verde em mA
+     * @param blueMa Corrente do azul em mA
+     * @param whiteMa Corrente do branco em mA (RGBW)
+     * @param idleUa Corrente em repouso por LED em uA
+     */
+    void setCurrentCoefficients(uint8_t redMa, uint8_t greenMa, uint8_t blueMa,
+                                uint8_t whiteMa = LED_CURRENT_CHANNEL_MA,
+                                uint16_t idleUa = LED_CURRENT_IDLE_UA);
+    
+    /**
+     * @brief Estima a corrente do frame atual com o brilho global
+     * 
+     * Usa as somas por canal mantidas em setPixelColor, sem varrer o buffer.
+     * 
+     * @return Corrente estimada em mA
+     */
+    uint32_t estimateCurrent() const;
+    
+    /**
+     * @brief Brilho efetivamente aplicado no último show()
+     */
+    uint8_t getFrameBrightness() const { return _frameBrightness; }
+    
     // ==================== Métodos estáticos de cor ====================
     
     /**
@@ -226,18 +359,27 @@ public:
     
     /**
      * @brief Efeito rainbow (arco-íris)
+     * 
+     * Gera as matizes incrementalmente e converte em blocos via LedColor::hsvSpan.
+     * 
      * @param startHue Matiz inicial
      */
     void rainbow(uint8_t startHue = 0);
     
     /**
      * @brief Efeito de rotação dos LEDs
+     * 
+     * Apenas ajusta o offset lógico do anel, sem copiar o buffer.
+     * 
      * @param positions Número de posições para rotacionar (positivo = direita)
      */
     void rotate(int16_t positions = 1);
     
     /**
      * @brief Shift dos LEDs (similar a rotate, mas preenche com preto)
+     * 
+     * Ajusta o offset do anel e apaga apenas a faixa revelada.
+     * 
      * @param positions Posições para shiftar
      */
     void shift(int16_t positions = 1);
@@ -251,36 +393,204 @@ public:
      * @brief Verifica se pode enviar (respeitando tempo de reset)
      */
     bool canShow();
+    
+    /**
+     * @brief Define o intervalo do reenvio completo
+     * 
+     * O show() envia apenas os LEDs até o maior índice alterado; os demais
+     * mantêm a cor travada. Um envio completo periódico recupera LEDs que
+     * receberam um frame corrompido.
+     * 
+     * @param ms Intervalo em ms (0 = sempre enviar a fita inteira)
+     */
+    void setFullRefreshInterval(uint16_t ms) { _fullRefreshMs = ms; }
+    
+    /**
+     * @brief Quantidade de LEDs enviados no último show()
+     */
+    uint16_t getLastSentCount() const { return _lastSentCount; }
+
+protected:
+    void _setBufferBytesPerLed(uint8_t bytesPerLed) { _bufferBytesPerLed = bytesPerLed; }
+    void _setPaletteBuffers(Color* palette, uint16_t* paletteUsage) { _palette = palette; _paletteUsage = paletteUsage; }
+    void _setDirtyBits(uint32_t* dirtyBits) { _dirtyBits = dirtyBits; }
 
 private:
     LedConfig _config;
     uint16_t _numLeds;
     uint8_t _brightness;
+    uint8_t _frameBrightness;   // Brilho do frame após o limitador de corrente
     bool _begun;
+    bool _ownsBuffers;      // Buffers alocados por begin() (liberados no destrutor)
     
     // Buffer de cores (RGB ou RGBW por LED)
     uint8_t* _pixelBuffer;
     uint16_t _pixelBufferSize;
     
+    // Offset do anel: o LED lógico i fica na posição física (i + _ringOffset) % _numLeds
+    uint16_t _ringOffset;
+    
     // Buffer DMA (valores PWM para cada bit + reset)
     uint16_t* _dmaBuffer;
     uint16_t _dmaBufferSize;
     
+    // Bytes por LED que os buffers externos comportam (0 = alocar em begin())
+    uint8_t _bufferBytesPerLed;
+    
+    // Modo indexado: paleta e quantidade de LEDs usando cada entrada
+    Color* _palette;
+    uint16_t* _paletteUsage;
+    
+    // Limitador de corrente: soma dos bytes em cada posição do pixel (0-3)
+    uint32_t _positionSum[BYTES_PER_LED_RGBW];
+    uint32_t _currentLimitMa;
+    uint8_t _channelMa[BYTES_PER_LED_RGBW];    // R, G, B, W
+    uint16_t _idleUaPerLed;
+    
+    // Envio truncado: LEDs lógicos [0, _dirtyCount) mudaram desde o último show()
+    uint16_t _dirtyCount;
+    // Codificação incremental: um bit por LED lógico a recodificar no buffer DMA
+    // (nullptr = recodificar todo o prefixo enviado)
+    uint32_t* _dirtyBits;
+    bool _allDirty;
+    uint16_t _lastSentCount;
+    uint8_t _sentBrightness;    // Brilho do frame com que o buffer DMA foi codificado
+    uint16_t _fullRefreshMs;
+    uint32_t _lastFullRefresh;
+    
     // Controle de timing
     uint32_t _lastShowTime;
     static const uint32_t RESET_TIME_US = 300;  // Tempo de reset em microsegundos
     
     // Métodos internos
+    void _setDefaultConfig(uint16_t numLeds);
     void _initTimer();
     void _initDMA();
     void _initGPIO();
-    void _encodePixels();
+    void _transfer(const uint16_t* slots, uint32_t length);
+    void _encodePixels(uint16_t count);
+    void _encodeDirty(uint16_t count);
+    void _markDirty(uint16_t index)
+    {
+        if (index >= _dirtyCount) _dirtyCount = index + 1;
+        if (_dirtyBits) _dirtyBits[index >> 5] |= 1UL << (index & 31);
+    }
+    void _markAllDirty() { _dirtyCount = _numLeds; _allDirty = true; }
     void _encodeByte(uint8_t byte, uint16_t* dest);
     uint8_t _applyBrightness(uint8_t value);
+    uint8_t _limitBrightness() const;
+    uint32_t _dynamicCurrentUa() const;
+    void _subtractSums(const uint8_t* pixel, uint16_t count);
+    uint8_t _bytesPerLed() const;
+    uint16_t _physicalIndex(uint16_t index) const;
+    uint16_t _paletteSize() const { return LED_CONTROLLER_PALETTE_SIZE(_config.indexBits); }
+    uint8_t _readIndex(uint16_t physical) const;
+    void _writeIndex(uint16_t physical, uint8_t value);
+    uint8_t _paletteIndexFor(Color color);
+    void _encodeRange(uint16_t start, uint16_t end, uint16_t*& dmaPtr);
+    void _clearRange(uint16_t startIndex, uint16_t count);
     
     // Mapeamento Timer->DMA Channel
     dma_channel _getTimerDMAChannel();
     volatile uint32_t* _getTimerCCR();
 };
 
+/**
+ * @brief Armazenamento estático do StaticLedController
+ * 
+ * Classe base separada para ser construída antes do LedController.
+ */
+template<uint16_t N, uint8_t BytesPerLed>
+struct LedControllerStorage {
+    uint8_t pixelStorage[LED_CONTROLLER_PIXEL_BUFFER_SIZE(N, BytesPerLed)];
+    uint16_t dmaStorage[LED_CONTROLLER_DMA_BUFFER_SIZE(N, BytesPerLed)];
+    uint32_t dirtyStorage[LED_CONTROLLER_DIRTY_WORDS(N)];
+};
+
+/**
+ * @brief LedController com buffers dimensionados em tempo de compilação
+ * 
+ * Declarado como global, os buffers ficam em .bss e o linker reporta o uso
+ * de RAM. begin() não aloca e não pode falhar por falta de heap.
+ * 
+ * @tparam N Número de LEDs
+ * @tparam BytesPerLed BYTES_PER_LED_RGB ou BYTES_PER_LED_RGBW
+ */
+template<uint16_t N, uint8_t BytesPerLed = BYTES_PER_LED_RGB>
+class StaticLedController : private LedControllerStorage<N, BytesPerLed>, public LedController {
+public:
+    static const uint16_t LED_COUNT = N;
+    
+    StaticLedController() :
+        LedController(N, LedControllerStorage<N, BytesPerLed>::pixelStorage,
+                      LedControllerStorage<N, BytesPerLed>::dmaStorage)
+    {
+        _setBufferBytesPerLed(BytesPerLed);
+        _setDirtyBits(LedControllerStorage<N, BytesPerLed>::dirtyStorage);
+    }
+    
+    StaticLedController(LedConfig config) :
+        LedController(_withCount(config), LedControllerStorage<N, BytesPerLed>::pixelStorage,
+                      LedControllerStorage<N, BytesPerLed>::dmaStorage, BytesPerLed)
+    {
+        _setDirtyBits(LedControllerStorage<N, BytesPerLed>::dirtyStorage);
+    }
+    
+    uint16_t numPixels() const { return N; }
+
+private:
+    static LedConfig _withCount(LedConfig config) { config.numLeds = N; return config; }
+};
+
+/**
+ * @brief Armazenamento estático do StaticIndexedLedController
+ */
+template<uint16_t N, uint8_t Bits, uint8_t BytesPerLed>
+struct IndexedLedControllerStorage {
+    uint8_t pixelStorage[LED_CONTROLLER_INDEXED_BUFFER_SIZE(N, Bits)];
+    uint16_t dmaStorage[LED_CONTROLLER_DMA_BUFFER_SIZE(N, BytesPerLed)];
+    Color paletteStorage[LED_CONTROLLER_PALETTE_SIZE(Bits)];
+    uint16_t usageStorage[LED_CONTROLLER_PALETTE_SIZE(Bits)];
+    uint32_t dirtyStorage[LED_CONTROLLER_DIRTY_WORDS(N)];
+};
+
+/**
+ * @brief LedController em modo indexado com buffers em tempo de compilação
+ * 
+ * @tparam N Número de LEDs
+ * @tparam Bits Bits por LED (4 ou 8)
+ * @tparam BytesPerLed BYTES_PER_LED_RGB ou BYTES_PER_LED_RGBW
+ */
+template<uint16_t N, uint8_t Bits, uint8_t BytesPerLed = BYTES_PER_LED_RGB>
+class StaticIndexedLedController : private IndexedLedControllerStorage<N, Bits, BytesPerLed>, public LedController {
+    static_assert(Bits == 4 || Bits == 8, "Indexed mode supports 4 or 8 bits per LED");
+    typedef IndexedLedControllerStorage<N, Bits, BytesPerLed> Storage;
+public:
+    static const uint16_t LED_COUNT = N;
+    
+    StaticIndexedLedController() :
+        LedController(N, Storage::pixelStorage, Storage::dmaStorage)
+    {
+        _init();
+    }
+    
+    StaticIndexedLedController(LedConfig config) :
+        LedController(_withCount(config), Storage::pixelStorage, Storage::dmaStorage, BytesPerLed)
+    {
+        _init();
+    }
+    
+    uint16_t numPixels() const { return N; }
+
+private:
+    void _init()
+    {
+        _setBufferBytesPerLed(BytesPerLed);
+        _setPaletteBuffers(Storage::paletteStorage, Storage::usageStorage);
+        _setDirtyBits(Storage::dirtyStorage);
+        setIndexedMode(Bits);
+    }
+    static LedConfig _withCount(LedConfig config) { config.numLeds = N; return config; }
+};
+
 #endif // __LED_CONTROLLER_H__
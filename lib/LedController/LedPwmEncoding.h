@@ -0,0 +1,53 @@
+/**
+ * @file LedPwmEncoding.h
+ * @brief Codificação dos bits WS2812B em valores de duty cycle do PWM
+ * @version 1.0
+ * @date 2026-10-18
+ * 
+ * Não depende do core Arduino nem da libmaple, para poder ser compilado e
+ * medido também no host.
+ * 
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef __LED_PWM_ENCODING_H__
+#define __LED_PWM_ENCODING_H__
+
+#include <stdint.h>
+
+// Configurações de timing para WS2812B @ 72MHz
+// Período PWM = 90 ciclos = 1.25us @ 72MHz (800kHz)
+#define WS2812_PWM_PERIOD       90
+#define WS2812_PWM_HIGH         58      // ~0.8us para bit 1
+#define WS2812_PWM_LOW          29      // ~0.4us para bit 0
+#define WS2812_RESET_CYCLES     50      // Ciclos de reset (>50us)
+
+// Bytes por LED (GRB = 3 bytes, GRBW = 4 bytes)
+#define BYTES_PER_LED_RGB       3
+#define BYTES_PER_LED_RGBW      4
+#define BITS_PER_BYTE           8
+
+// Tamanhos dos buffers para n LEDs com bpl bytes por LED
+#define LED_CONTROLLER_PIXEL_BUFFER_SIZE(n, bpl)  ((n) * (bpl))
+#define LED_CONTROLLER_DMA_BUFFER_SIZE(n, bpl)    ((n) * (bpl) * BITS_PER_BYTE + WS2812_RESET_CYCLES)
+
+// Modo indexado: buffer de índices com bits (4 ou 8) por LED e entradas da paleta
+#define LED_CONTROLLER_INDEXED_BUFFER_SIZE(n, bits)  (((n) * (bits) + 7) / 8)
+#define LED_CONTROLLER_PALETTE_SIZE(bits)            (1 << (bits))
+#define LED_CONTROLLER_DIRTY_WORDS(n)                (((n) + 31) / 32)
+
+/**
+ * @brief Codifica 8 bits, MSB primeiro, em 8 valores de duty cycle
+ */
+static inline void ledPwmEncodeByte(uint8_t byte, uint16_t* dest)
+{
+    for (int8_t bit = 7; bit >= 0; bit--) {
+        if (byte & (1 << bit)) {
+            *dest++ = WS2812_PWM_HIGH;  // Bit 1: duty cycle alto
+        } else {
+            *dest++ = WS2812_PWM_LOW;   // Bit 0: duty cycle baixo
+        }
+    }
+}
+
+#endif // __LED_PWM_ENCODING_H__
@@ -0,0 +1,94 @@
+/**
+ * @file Profiler.cpp
+ * @brief Implementação da tabela de probes
+ * @version 1.0
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ */
+
+#include "Profiler.h"
+#include <string.h>
+
+ProfilerProbe Profiler::_probes[PROFILER_MAX_PROBES];
+uint8_t Profiler::_probeCount = 0;
+
+void Profiler::_initClock()
+{
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+    volatile uint32_t* demcr = (volatile uint32_t*)0xE000EDFC;
+    volatile uint32_t* dwtCtrl = (volatile uint32_t*)0xE0001000;
+    volatile uint32_t* dwtCyccnt = (volatile uint32_t*)0xE0001004;
+    
+    *demcr |= (1UL << 24);      // TRCENA: habilitar DWT
+    *dwtCyccnt = 0;
+    *dwtCtrl |= 1;              // CYCCNTENA
+#endif
+}
+
+uint8_t Profiler::probe(const char* name)
+{
+    for (uint8_t i = 0; i < _probeCount; i++) {
+        if (strcmp(_probes[i].name, name) == 0) return i;
+    }
+    
+    if (_probeCount == 0) _initClock();
+    
+    // Tabela cheia: acumular na última entrada
+    if (_probeCount >= PROFILER_MAX_PROBES) return PROFILER_MAX_PROBES - 1;
+    
+    ProfilerProbe* p = &_probes[_probeCount];
+    p->name = name;
+    p->count = 0;
+    p->min = UINT32_MAX;
+    p->max = 0;
+    p->total = 0;
+    return _probeCount++;
+}
+
+void Profiler::record(uint8_t id, uint32_t ticks)
+{
+    ProfilerProbe* p = &_probes[id];
+    p->count++;
+    p->total += ticks;
+    if (ticks < p->min) p->min = ticks;
+    if (ticks > p->max) p->max = ticks;
+}
+
+void Profiler::count(uint8_t id, uint32_t value)
+{
+    record(id, value);
+}
+
+void Profiler::reset()
+{
+    for (uint8_t i = 0; i < _probeCount; i++) {
+        _probes[i].count = 0;
+        _probes[i].min = UINT32_MAX;
+        _probes[i].max = 0;
+        _probes[i].total = 0;
+    }
+}
+
+#ifdef ARDUINO
+void Profiler::dump(Print* out)
+{
+    out->print(F("unit="));
+    out->println(F(PROFILER_UNIT));
+    
+    for (uint8_t i = 0; i < _probeCount; i++) {
+        const ProfilerProbe* p = &_probes[i];
+        out->print(p->name);
+        out->print(F(": count="));
+        out->print(p->count);
+        out->print(F(" min="));
+        out->print(p->count ? p->min : 0);
+        out->print(F(" avg="));
+        out->print(p->count ? (uint32_t)(p->total / p->count) : 0);
+        out->print(F(" max="));
+        out->print(p->max);
+        out->print(F(" total="));
+        out->println((uint32_t)p->total);
+    }
+}
+#endif
@@ -0,0 +1,158 @@
+/**
+ * @file Profiler.h
+ * @brief Probes de tempo RAII e contadores nomeados
+ * @version 1.0
+ * @date 2026-10-18
+ * 
+ * No Cortex-M3 mede ciclos com o contador DWT_CYCCNT; no host usa
+ * std::chrono (nanossegundos). Os resultados ficam em uma tabela estática
+ * de tamanho fixo (min/max/total/contagem por probe).
+ * 
+ * Com PROFILER_ENABLED = 0 (padrão) as macros não geram código. Para ativar,
+ * adicione -D PROFILER_ENABLED=1 em build_flags no platformio.ini.
+ * 
+ * Uso:
+ *   void show() {
+ *       PROFILE_SCOPE("show");
+ *       ...
+ *   }
+ *   PROFILE_COUNT("frames", 1);
+ * 
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef __PROFILER_H__
+#define __PROFILER_H__
+
+#include <stdint.h>
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#endif
+
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 0
+#endif
+
+#ifndef PROFILER_MAX_PROBES
+#define PROFILER_MAX_PROBES 16
+#endif
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+#define PROFILER_UNIT "cycles"
+#elif defined(ARDUINO)
+#define PROFILER_UNIT "us"
+#else
+#define PROFILER_UNIT "ns"
+#endif
+
+/**
+ * @brief Estatísticas de uma probe
+ */
+struct ProfilerProbe {
+    const char* name;
+    uint32_t count;     // Execuções (ou chamadas de PROFILE_COUNT)
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;     // Soma dos tempos (ou dos valores contados)
+};
+
+class Profiler {
+public:
+    /**
+     * @brief Registra (ou encontra) uma probe pelo nome
+     * @return Índice na tabela; a última entrada absorve o excesso
+     */
+    static uint8_t probe(const char* name);
+    
+    /**
+     * @brief Registra uma medição de tempo
+     */
+    static void record(uint8_t id, uint32_t ticks);
+    
+    /**
+     * @brief Acumula um valor em um contador nomeado
+     */
+    static void count(uint8_t id, uint32_t value);
+    
+    /**
+     * @brief Leitura do relógio da probe (ciclos, us ou ns, ver PROFILER_UNIT)
+     */
+    static inline uint32_t now();
+    
+    static uint8_t probeCount() { return _probeCount; }
+    static const ProfilerProbe* get(uint8_t id) { return &_probes[id]; }
+    static void reset();
+    
+#ifdef ARDUINO
+    /**
+     * @brief Imprime a tabela: nome, contagem, min, média, max e total
+     */
+    static void dump(Print* out);
+#endif
+
+private:
+    static ProfilerProbe _probes[PROFILER_MAX_PROBES];
+    static uint8_t _probeCount;
+    
+    static void _initClock();
+};
+
+/**
+ * @brief Probe de escopo: mede do construtor ao destrutor
+ */
+class ProfileScope {
+public:
+    explicit ProfileScope(uint8_t id) : _id(id), _start(Profiler::now()) {}
+    ~ProfileScope() { Profiler::record(_id, Profiler::now() - _start); }
+
+private:
+    uint8_t _id;
+    uint32_t _start;
+};
+
+#if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+
+// DWT_CYCCNT: habilitado em _initClock() no registro da primeira probe
+inline uint32_t Profiler::now()
+{
+    return *(volatile uint32_t*)0xE0001004;
+}
+
+#elif defined(ARDUINO)
+
+inline uint32_t Profiler::now()
+{
+    return micros();
+}
+
+#else
+
+#include <chrono>
+
+inline uint32_t Profiler::now()
+{
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#endif
+
+#define PROFILER_CONCAT2(a, b) a##b
+#define PROFILER_CONCAT(a, b) PROFILER_CONCAT2(a, b)
+
+#if PROFILER_ENABLED
+#define PROFILE_SCOPE(name) \
+    static const uint8_t PROFILER_CONCAT(_profilerProbe, __LINE__) = Profiler::probe(name); \
+    ProfileScope PROFILER_CONCAT(_profilerScope, __LINE__)(PROFILER_CONCAT(_profilerProbe, __LINE__))
+#define PROFILE_COUNT(name, value) \
+    do { \
+        static const uint8_t _profilerCounter = Profiler::probe(name); \
+        Profiler::count(_profilerCounter, value); \
+    } while (0)
+#else
+#define PROFILE_SCOPE(name) do { } while (0)
+#define PROFILE_COUNT(name, value) do { } while (0)
+#endif
+
+#endif // __PROFILER_H__
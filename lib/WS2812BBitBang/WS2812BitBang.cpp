@@ -8,12 +8,23 @@
 WS2812_BitBang::WS2812_BitBang(uint16_t numLeds, uint8_t pin) {
     _numLeds = numLeds;
     _pin = pin;
-    _pixels = new uint8_t[numLeds * 3];
-    memset(_pixels, 0, numLeds * 3);
+    _pixels = new uint8_t[WS2812_BITBANG_BUFFER_SIZE(numLeds)];
+    _ownsPixels = true;
+    memset(_pixels, 0, WS2812_BITBANG_BUFFER_SIZE(numLeds));
+}
+
+WS2812_BitBang::WS2812_BitBang(uint16_t numLeds, uint8_t pin, uint8_t *buffer) {
+    _numLeds = numLeds;
+    _pin = pin;
+    _pixels = buffer;
+    _ownsPixels = false;
+    memset(_pixels, 0, WS2812_BITBANG_BUFFER_SIZE(numLeds));
 }
 
 WS2812_BitBang::~WS2812_BitBang() {
-    delete[] _pixels;
+    if (_ownsPixels) {
+        delete[] _pixels;
+    }
 }
 
 void WS2812_BitBang::begin() {
@@ -3,9 +3,14 @@
 
 #include <Arduino.h>
 
+// Bytes needed for the GRB buffer of n LEDs
+#define WS2812_BITBANG_BUFFER_SIZE(n) ((n) * 3)
+
 class WS2812_BitBang {
 public:
     WS2812_BitBang(uint16_t numLeds, uint8_t pin);
+    // Uses caller supplied storage of WS2812_BITBANG_BUFFER_SIZE(numLeds) bytes, nothing is allocated
+    WS2812_BitBang(uint16_t numLeds, uint8_t pin, uint8_t *buffer);
     ~WS2812_BitBang();
     
     void begin();
@@ -20,6 +25,7 @@ private:
     uint16_t _numLeds;
     uint8_t _pin;
     uint8_t *_pixels;
+    bool _ownsPixels;
     
     volatile uint32_t *_portSet;
     volatile uint32_t *_portClear;
@@ -29,4 +35,19 @@ private:
     void sendBit(bool bitVal);
 };
 
+// Storage for WS2812_BitBangStatic, a separate base so it is constructed first
+template<uint16_t N>
+struct WS2812_BitBangStorage {
+    uint8_t storage[WS2812_BITBANG_BUFFER_SIZE(N)];
+};
+
+// WS2812_BitBang with its buffer sized at compile time (static storage when declared global)
+template<uint16_t N>
+class WS2812_BitBangStatic : private WS2812_BitBangStorage<N>, public WS2812_BitBang {
+public:
+    static const uint16_t LED_COUNT = N;
+
+    WS2812_BitBangStatic(uint8_t pin) : WS2812_BitBang(N, pin, WS2812_BitBangStorage<N>::storage) {}
+};
+
 #endif
\ No newline at end of file
@@ -26,21 +26,51 @@
 #include "pins_arduino.h"
 #include "wiring_private.h"
 #include <SPI.h>
+#include <Profiler.h>
+
+// Single definition of the encode table declared extern in WS2812B.h
+template struct WS2812B_LUT_DATA;
+
+// SPI_CLOCK_DIVn constant for the divisor selected in WS2812BEncoding.h
+static uint32_t spiClockDivider(uint16_t divisor)
+{
+  switch (divisor)
+  {
+    case 2:   return SPI_CLOCK_DIV2;
+    case 4:   return SPI_CLOCK_DIV4;
+    case 8:   return SPI_CLOCK_DIV8;
+    case 16:  return SPI_CLOCK_DIV16;
+    case 32:  return SPI_CLOCK_DIV32;
+    case 64:  return SPI_CLOCK_DIV64;
+    case 128: return SPI_CLOCK_DIV128;
+    default:  return SPI_CLOCK_DIV256;
+  }
+}
 
 
 // Constructor when n is the number of LEDs in the strip
 WS2812B::WS2812B(uint16_t number_of_leds) :
-  brightness(0), pixels(NULL)
+  begun(false), dirtyCount(0), sentCount(0), fullRefreshMs(WS2812B_FULL_REFRESH_MS), sendingBytes(0),
+  brightness(0), pixels(NULL), doubleBuffer(NULL), endTime(0), lastFullRefresh(0), ownsBuffer(false)
 {
   updateLength(number_of_leds);
 }
 
+// Constructor using a caller supplied buffer of WS2812B_BUFFER_SIZE(number_of_leds) bytes
+WS2812B::WS2812B(uint16_t number_of_leds, uint8_t *buffer) :
+  begun(false), dirtyCount(0), sentCount(0), fullRefreshMs(WS2812B_FULL_REFRESH_MS), sendingBytes(0),
+  brightness(0), pixels(NULL), doubleBuffer(NULL), endTime(0), lastFullRefresh(0), ownsBuffer(false)
+{
+  setBuffer(number_of_leds, buffer);
+}
+
 
 WS2812B::~WS2812B() 
 {
-  if(pixels)   
+  // pixels may point at the second half, so always free the start of the double buffer
+  if(ownsBuffer && doubleBuffer)   
   {
-	  free(pixels);
+	  free(doubleBuffer);
   }
   SPI.end();
 }
@@ -49,7 +79,7 @@ void WS2812B::begin(void) {
 
 if (!begun)
 {
-  SPI.setClockDivider(WS2812B_SPI_DIVISOR);
+  SPI.setClockDivider(spiClockDivider(WS2812B_SPI_CLOCK_DIV));
   SPI.begin();
   begun = true;
 }
@@ -57,33 +87,81 @@ if (!begun)
 
 void WS2812B::updateLength(uint16_t n)
 {
+  if(!ownsBuffer && doubleBuffer)
+  {
+	  return; // Static storage cannot be resized
+  }
+
   if(doubleBuffer) 
   {
 	  free(doubleBuffer); 
   }
 
-  numBytes = (n<<3) + n + 2; // 9 encoded bytes per pixel. 1 byte empty peamble to fix issue with SPI MOSI and on byte at the end to clear down MOSI 
-							// Note. (n<<3) +n is a fast way of doing n*9
-  if((doubleBuffer = (uint8_t *)malloc(numBytes*2)))
+  if((doubleBuffer = (uint8_t *)malloc(WS2812B_BUFFER_SIZE(n))))
   {
-    numLEDs = n;	 
-	pixels = doubleBuffer;
-	// Only need to init the part of the double buffer which will be interacted with by the API e.g. setPixelColor
-	*pixels=0;//clear the preamble byte
-	*(pixels+numBytes-1)=0;// clear the post send cleardown byte.
-	clear();// Set the encoded data to all encoded zeros 
+    ownsBuffer = true;
+    setBuffer(n, doubleBuffer);
   } 
   else 
   {
+    ownsBuffer = false;
+    pixels = NULL;
     numLEDs = numBytes = 0;
   }
 }
 
+void WS2812B::setBuffer(uint16_t n, uint8_t *buffer)
+{
+  numBytes = n * WS2812B_BYTES_PER_PIXEL + 2; // 9 (3 bit symbols) or 12 (4 bit symbols) encoded bytes per pixel. 1 byte empty peamble to fix issue with SPI MOSI and on byte at the end to clear down MOSI 
+  numLEDs = n;
+  doubleBuffer = buffer;
+  pixels = doubleBuffer;
+  // Only need to init the part of the double buffer which will be interacted with by the API e.g. setPixelColor
+  *pixels=0;//clear the preamble byte
+  *(pixels+numBytes-1)=0;// clear the post send cleardown byte.
+  clear();// Set the encoded data to all encoded zeros 
+}
+
 // Sends the current buffer to the leds
+// Pixels past the highest one changed since the last call keep their latched colour, so only
+// that prefix is clocked out. The whole strip is sent every fullRefreshMs, and nothing if no pixel changed.
 void WS2812B::show(void) 
 {
-  SPI.dmaSendAsync(pixels,numBytes);// Start the DMA transfer of the current pixel buffer to the LEDs and return immediately.
+  PROFILE_SCOPE("WS2812B::show");
 
+  uint16_t count = dirtyCount;
+  uint32_t now = millis();
+  if (fullRefreshMs == 0 || (now - lastFullRefresh) >= fullRefreshMs)
+  {
+	count = numLEDs;
+  }
+  sentCount = count;
+  if (count == 0)
+  {
+	return;
+  }
+  if (count == numLEDs)
+  {
+	lastFullRefresh = now;
+  }
+  dirtyCount = 0;
+
+  // Single buffer mode: the previous send must be over before the buffer is sent again
+  waitForDma(0, numBytes);
+
+  // Preamble + encoded pixels + cleardown byte. Past the prefix the cleardown byte is the first
+  // byte of the next pixel, so zero it for this send and restore it in the new buffer below
+  uint16_t sendBytes = count * WS2812B_BYTES_PER_PIXEL + 2;
+  uint8_t savedByte = pixels[sendBytes-1];
+  pixels[sendBytes-1] = 0;
+
+  SPI.dmaSendAsync(pixels,sendBytes);// Start the DMA transfer of the current pixel buffer to the LEDs and return immediately.
+
+#if WS2812B_SINGLE_BUFFER
+  // Sent in place: writes wait for DMA (waitForDma), which also restores the saved byte
+  sendingBytes = sendBytes;
+  sendingSaved = savedByte;
+#else
   // Need to copy the last / current buffer to the other half of the double buffer as most API code does not rebuild the entire contents
   // from scratch. Often just a few pixels are changed e.g in a chaser effect
   
@@ -99,6 +177,63 @@ void WS2812B::show(void)
 	pixels	= doubleBuffer;  // set pixels to first buffer
 	memcpy(pixels,doubleBuffer+numBytes,numBytes);	 // copy second buffer to first buffer 
   }	
+  pixels[sendBytes-1] = savedByte;
+#endif
+}
+
+// DMA the caller's encoded frame straight from where it is stored (flash included)
+void WS2812B::showEncoded(const uint8_t *frame, uint16_t count)
+{
+  PROFILE_SCOPE("WS2812B::showEncoded");
+
+  if (count > numLEDs)
+  {
+	count = numLEDs;
+  }
+  waitForDma(0, numBytes);
+  SPI.dmaSendAsync((void *)frame, count * WS2812B_BYTES_PER_PIXEL + 2);
+  sentCount = count;
+  // The strip no longer shows the pixel buffer
+  dirtyCount = numLEDs;
+}
+
+void WS2812B::writeEncoded(uint16_t first, const uint8_t *encoded, uint16_t count)
+{
+  if (first >= numLEDs)
+  {
+	return;
+  }
+  if (count > numLEDs - first)
+  {
+	count = numLEDs - first;
+  }
+  uint16_t offset = first * WS2812B_BYTES_PER_PIXEL + 1;
+  uint16_t bytes = count * WS2812B_BYTES_PER_PIXEL;
+  waitForDma(offset, offset + bytes);
+
+  // The last pixel that differs is the end of the prefix to send
+  for (uint16_t i = count; i > 0 && first + i > dirtyCount; i--)
+  {
+	uint16_t pixel = (i - 1) * WS2812B_BYTES_PER_PIXEL;
+	if (memcmp(pixels + offset + pixel, encoded + pixel, WS2812B_BYTES_PER_PIXEL) != 0)
+	{
+	  dirtyCount = first + i;
+	}
+  }
+  memcpy(pixels + offset, encoded, bytes);
+}
+
+void WS2812B::readEncoded(uint16_t first, uint8_t *encoded, uint16_t count) const
+{
+  if (first >= numLEDs)
+  {
+	return;
+  }
+  if (count > numLEDs - first)
+  {
+	count = numLEDs - first;
+  }
+  memcpy(encoded, pixels + first * WS2812B_BYTES_PER_PIXEL + 1, count * WS2812B_BYTES_PER_PIXEL);
 }
 
 /*Sets a specific pixel to a specific r,g,b colour 
@@ -107,26 +242,13 @@ void WS2812B::show(void)
 */
 void WS2812B::setPixelColor(uint16_t n, uint8_t r, uint8_t g, uint8_t b)
  {
-   uint8_t *bptr = pixels + (n<<3) + n +1;
-   uint8_t *tPtr = (uint8_t *)encoderLookup + g*2 + g;// need to index 3 x g into the lookup
-   
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;
-
-   tPtr = (uint8_t *)encoderLookup + r*2 + r;
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;   
-   
-   tPtr = (uint8_t *)encoderLookup + b*2 + b;
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;
+   PROFILE_SCOPE("WS2812B::setPixelColor");
+   writePixel(n, r, g, b);
  }
 
 void WS2812B::setPixelColor(uint16_t n, uint32_t c)
   {
+    PROFILE_SCOPE("WS2812B::setPixelColor");
      uint8_t r,g,b;
    
     if(brightness) 
@@ -142,22 +264,24 @@ void WS2812B::setPixelColor(uint16_t n, uint32_t c)
 	  b = (uint8_t)c;		
 	}
 	
-   uint8_t *bptr = pixels + (n<<3) + n +1;
-   uint8_t *tPtr = (uint8_t *)encoderLookup + g*2 + g;// need to index 3 x g into the lookup
-   
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;
-
-   tPtr = (uint8_t *)encoderLookup + r*2 + r;
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;   
-   
-   tPtr = (uint8_t *)encoderLookup + b*2 + b;
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;
-   *bptr++ = *tPtr++;
+   writePixel(n, r, g, b);
+}
+
+// Encodes the pixel and only stores it, and marks it for sending, if the encoded bytes differ.
+// Hosts such as SimHub resend every pixel in each frame, even when just a few changed
+void WS2812B::writePixel(uint16_t n, uint8_t r, uint8_t g, uint8_t b)
+{
+   uint8_t encoded[WS2812B_BYTES_PER_PIXEL];
+   uint16_t offset = n * WS2812B_BYTES_PER_PIXEL + 1;
+   uint8_t *bptr = pixels + offset;
+
+   waitForDma(offset, offset + WS2812B_BYTES_PER_PIXEL);
+   WS2812B_encodePixel(encoded, r, g, b);
+   if (memcmp(bptr, encoded, WS2812B_BYTES_PER_PIXEL) != 0)
+   {
+     memcpy(bptr, encoded, WS2812B_BYTES_PER_PIXEL);
+     if (n >= dirtyCount) dirtyCount = n + 1;
+   }
 }
 
 // Convert separate R,G,B into packed 32-bit RGB color.
@@ -198,6 +322,7 @@ void WS2812B::setBrightness(uint8_t b) {
   // brightness (off), 255 = just below max brightness.
   uint8_t newBrightness = b + 1;
   if(newBrightness != brightness) { // Compare against prior value
+    waitForDma(0, numBytes);
     // Brightness has changed -- re-scale existing data in RAM
     uint8_t  c,
             *ptr           = pixels,
@@ -212,6 +337,7 @@ void WS2812B::setBrightness(uint8_t b) {
       *ptr++ = (c * scale) >> 8;
     }
     brightness = newBrightness;
+    dirtyCount = numLEDs;
   }
 }
 
@@ -225,14 +351,5 @@ uint8_t WS2812B::getBrightness(void) const {
 */
 void WS2812B::clear() 
 {
-	uint8_t * bptr= pixels+1;// Note first byte in the buffer is a preable and is always zero. hence the +1
-	uint8_t *tPtr;
-
-	for(int i=0;i< (numLEDs *3);i++)
-	{
-	   tPtr = (uint8_t *)encoderLookup;
-   	   *bptr++ = *tPtr++;
-	   *bptr++ = *tPtr++;
-	   *bptr++ = *tPtr++;	
-	}
+	clearPixels(numLEDs);
 }
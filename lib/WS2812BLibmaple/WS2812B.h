@@ -16,39 +16,29 @@
 #define WS2812B_H
 
 #include <Arduino.h>
-/*
- * old version used 3 separate tables, one per byte of the 24 bit encoded data
- *
-static const uint8_t byte0Lookup[256]={0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x92,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x93,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9A,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0x9B,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD2,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xD3,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDA,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB,0xDB};
-static const uint8_t byte1Lookup[256]={0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x49,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x4D,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x69,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D,0x6D};
-static const uint8_t byte2Lookup[256]={0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6,0x24,0x26,0x34,0x36,0xA4,0xA6,0xB4,0xB6};
-*/
-
-// New version uses one large LUT as its faster index into sequential bytes for the GRB pattern
-static const uint8_t encoderLookup[256*3]={	0x92,0x49,0x24,0x92,0x49,0x26,0x92,0x49,0x34,0x92,0x49,0x36,0x92,0x49,0xA4,0x92,0x49,0xA6,0x92,0x49,0xB4,0x92,0x49,0xB6,0x92,0x4D,0x24,0x92,0x4D,0x26,0x92,0x4D,0x34,0x92,0x4D,0x36,0x92,0x4D,0xA4,0x92,0x4D,0xA6,0x92,0x4D,0xB4,0x92,0x4D,0xB6,0x92,0x69,0x24,0x92,0x69,0x26,0x92,0x69,0x34,0x92,0x69,0x36,0x92,0x69,0xA4,0x92,0x69,0xA6,0x92,0x69,0xB4,0x92,0x69,0xB6,0x92,0x6D,0x24,0x92,0x6D,0x26,0x92,0x6D,0x34,0x92,0x6D,0x36,0x92,0x6D,0xA4,0x92,0x6D,0xA6,0x92,0x6D,0xB4,0x92,0x6D,0xB6,0x93,0x49,0x24,0x93,0x49,0x26,0x93,0x49,0x34,0x93,0x49,0x36,0x93,0x49,0xA4,0x93,0x49,0xA6,0x93,0x49,0xB4,0x93,0x49,0xB6,0x93,0x4D,0x24,0x93,0x4D,0x26,0x93,0x4D,0x34,0x93,0x4D,0x36,0x93,0x4D,0xA4,0x93,0x4D,0xA6,0x93,0x4D,0xB4,0x93,0x4D,0xB6,0x93,0x69,0x24,0x93,0x69,0x26,0x93,0x69,0x34,0x93,0x69,0x36,0x93,0x69,0xA4,0x93,0x69,0xA6,0x93,0x69,0xB4,0x93,0x69,0xB6,0x93,0x6D,0x24,0x93,0x6D,0x26,0x93,0x6D,0x34,0x93,0x6D,0x36,0x93,0x6D,0xA4,0x93,0x6D,0xA6,0x93,0x6D,0xB4,0x93,0x6D,0xB6,0x9A,0x49,0x24,0x9A,0x49,0x26,0x9A,0x49,0x34,0x9A,0x49,0x36,0x9A,0x49,0xA4,0x9A,0x49,0xA6,0x9A,0x49,0xB4,0x9A,0x49,0xB6,0x9A,0x4D,0x24,0x9A,0x4D,0x26,0x9A,0x4D,0x34,0x9A,0x4D,0x36,0x9A,0x4D,0xA4,0x9A,0x4D,0xA6,0x9A,0x4D,0xB4,0x9A,0x4D,0xB6,0x9A,0x69,0x24,0x9A,0x69,0x26,0x9A,0x69,0x34,0x9A,0x69,0x36,0x9A,0x69,0xA4,0x9A,0x69,\
-											0xA6,0x9A,0x69,0xB4,0x9A,0x69,0xB6,0x9A,0x6D,0x24,0x9A,0x6D,0x26,0x9A,0x6D,0x34,0x9A,0x6D,0x36,0x9A,0x6D,0xA4,0x9A,0x6D,0xA6,0x9A,0x6D,0xB4,0x9A,0x6D,0xB6,0x9B,0x49,0x24,0x9B,0x49,0x26,0x9B,0x49,0x34,0x9B,0x49,0x36,0x9B,0x49,0xA4,0x9B,0x49,0xA6,0x9B,0x49,0xB4,0x9B,0x49,0xB6,0x9B,0x4D,0x24,0x9B,0x4D,0x26,0x9B,0x4D,0x34,0x9B,0x4D,0x36,0x9B,0x4D,0xA4,0x9B,0x4D,0xA6,0x9B,0x4D,0xB4,0x9B,0x4D,0xB6,0x9B,0x69,0x24,0x9B,0x69,0x26,0x9B,0x69,0x34,0x9B,0x69,0x36,0x9B,0x69,0xA4,0x9B,0x69,0xA6,0x9B,0x69,0xB4,0x9B,0x69,0xB6,0x9B,0x6D,0x24,0x9B,0x6D,0x26,0x9B,0x6D,0x34,0x9B,0x6D,0x36,0x9B,0x6D,0xA4,0x9B,0x6D,0xA6,0x9B,0x6D,0xB4,0x9B,0x6D,0xB6,0xD2,0x49,0x24,0xD2,0x49,0x26,0xD2,0x49,0x34,0xD2,0x49,0x36,0xD2,0x49,0xA4,0xD2,0x49,0xA6,0xD2,0x49,0xB4,0xD2,0x49,0xB6,0xD2,0x4D,0x24,0xD2,0x4D,0x26,0xD2,0x4D,0x34,0xD2,0x4D,0x36,0xD2,0x4D,0xA4,0xD2,0x4D,0xA6,0xD2,0x4D,0xB4,0xD2,0x4D,0xB6,0xD2,0x69,0x24,0xD2,0x69,0x26,0xD2,0x69,0x34,0xD2,0x69,0x36,0xD2,0x69,0xA4,0xD2,0x69,0xA6,0xD2,0x69,0xB4,0xD2,0x69,0xB6,0xD2,0x6D,0x24,0xD2,0x6D,0x26,0xD2,0x6D,0x34,0xD2,0x6D,0x36,0xD2,0x6D,0xA4,0xD2,0x6D,0xA6,0xD2,0x6D,0xB4,0xD2,0x6D,0xB6,0xD3,0x49,0x24,0xD3,0x49,0x26,0xD3,0x49,0x34,0xD3,0x49,0x36,0xD3,0x49,0xA4,0xD3,0x49,0xA6,0xD3,0x49,0xB4,0xD3,0x49,0xB6,0xD3,0x4D,0x24,0xD3,0x4D,0x26,0xD3,0x4D,0x34,0xD3,\
-											0x4D,0x36,0xD3,0x4D,0xA4,0xD3,0x4D,0xA6,0xD3,0x4D,0xB4,0xD3,0x4D,0xB6,0xD3,0x69,0x24,0xD3,0x69,0x26,0xD3,0x69,0x34,0xD3,0x69,0x36,0xD3,0x69,0xA4,0xD3,0x69,0xA6,0xD3,0x69,0xB4,0xD3,0x69,0xB6,0xD3,0x6D,0x24,0xD3,0x6D,0x26,0xD3,0x6D,0x34,0xD3,0x6D,0x36,0xD3,0x6D,0xA4,0xD3,0x6D,0xA6,0xD3,0x6D,0xB4,0xD3,0x6D,0xB6,0xDA,0x49,0x24,0xDA,0x49,0x26,0xDA,0x49,0x34,0xDA,0x49,0x36,0xDA,0x49,0xA4,0xDA,0x49,0xA6,0xDA,0x49,0xB4,0xDA,0x49,0xB6,0xDA,0x4D,0x24,0xDA,0x4D,0x26,0xDA,0x4D,0x34,0xDA,0x4D,0x36,0xDA,0x4D,0xA4,0xDA,0x4D,0xA6,0xDA,0x4D,0xB4,0xDA,0x4D,0xB6,0xDA,0x69,0x24,0xDA,0x69,0x26,0xDA,0x69,0x34,0xDA,0x69,0x36,0xDA,0x69,0xA4,0xDA,0x69,0xA6,0xDA,0x69,0xB4,0xDA,0x69,0xB6,0xDA,0x6D,0x24,0xDA,0x6D,0x26,0xDA,0x6D,0x34,0xDA,0x6D,0x36,0xDA,0x6D,0xA4,0xDA,0x6D,0xA6,0xDA,0x6D,0xB4,0xDA,0x6D,0xB6,0xDB,0x49,0x24,0xDB,0x49,0x26,0xDB,0x49,0x34,0xDB,0x49,0x36,0xDB,0x49,0xA4,0xDB,0x49,0xA6,0xDB,0x49,0xB4,0xDB,0x49,0xB6,0xDB,0x4D,0x24,0xDB,0x4D,0x26,0xDB,0x4D,0x34,0xDB,0x4D,0x36,0xDB,0x4D,0xA4,0xDB,0x4D,0xA6,0xDB,0x4D,0xB4,0xDB,0x4D,0xB6,0xDB,0x69,0x24,0xDB,0x69,0x26,0xDB,0x69,0x34,0xDB,0x69,0x36,0xDB,0x69,0xA4,0xDB,0x69,0xA6,0xDB,0x69,0xB4,0xDB,0x69,0xB6,0xDB,0x6D,0x24,0xDB,0x6D,0x26,0xDB,0x6D,0x34,0xDB,0x6D,0x36,0xDB,0x6D,0xA4,0xDB,0x6D,0xA6,0xDB,0x6D,0xB4,0xDB,0x6D,0xB6};
-
-// Set the SPI clock divisor to as close to 400ns as we can;
-// the WS2812 spec allows for +/- 150ns
-#if F_CPU == 72000000L
-  #define WS2812B_SPI_DIVISOR SPI_CLOCK_DIV32 // 444ns
-#elif F_CPU == 64000000L
-  #define WS2812B_SPI_DIVISOR SPI_CLOCK_DIV32 // 500ns
-#elif F_CPU == 48000000L
-  #define WS2812B_SPI_DIVISOR SPI_CLOCK_DIV16 // 333ns
-#elif F_CPU == 40000000L
-  #define WS2812B_SPI_DIVISOR SPI_CLOCK_DIV16 // 400ns
-#elif F_CPU == 36000000L
-  #define WS2812B_SPI_DIVISOR SPI_CLOCK_DIV16 // 444ns
-#elif F_CPU == 24000000L
-  #define WS2812B_SPI_DIVISOR SPI_CLOCK_DIV8 // 333ns
-#elif F_CPU == 16000000L
-  #define WS2812B_SPI_DIVISOR SPI_CLOCK_DIV8 // 500ns
-#elif F_CPU == 8000000L
-  #define WS2812B_SPI_DIVISOR SPI_CLOCK_DIV4 // 500ns
-#else
-  #error No clock divisor available for this F_CPU
+#include "WS2812BEncoding.h"
+
+// The SPI clock divisor and the bits per symbol are chosen at compile time from F_CPU
+// (see WS2812BEncoding.h) and static_assert'ed against the WS2812B timing
+
+// The encode table is instantiated once, in WS2812B.cpp
+extern template struct WS2812B_LUT_DATA;
+
+// While only the first pixels change, show() sends just that prefix. The whole strip
+// is still sent at this interval so a glitched pixel further down recovers
+#ifndef WS2812B_FULL_REFRESH_MS
+  #define WS2812B_FULL_REFRESH_MS 1000
+#endif
+
+// Single buffer mode (WS2812B_SINGLE_BUFFER, see WS2812BEncoding.h) halves the RAM of the strip.
+// show() sends the pixel buffer in place, and a write waits only while DMA has not yet read the
+// bytes it would change. The DMA channel of the SPI TX is polled to know how far the send has got
+#if WS2812B_SINGLE_BUFFER
+  #include <libmaple/dma.h>
+  #ifndef WS2812B_DMA_DEV
+    #define WS2812B_DMA_DEV DMA1
+    #define WS2812B_DMA_CHANNEL DMA_CH3 // SPI1 TX
+  #endif
 #endif
 
 class WS2812B {
@@ -56,6 +46,9 @@ class WS2812B {
 
   // Constructor: number of LEDs
   WS2812B (uint16_t number_of_leds);// Constuctor 
+  // Constructor using caller supplied storage of WS2812B_BUFFER_SIZE(number_of_leds) bytes.
+  // Nothing is allocated on the heap and updateLength() cannot grow the strip.
+  WS2812B (uint16_t number_of_leds, uint8_t *buffer);
     ~WS2812B();
   void
     begin(void),
@@ -78,6 +71,70 @@ class WS2812B {
  //   getPixelColor(uint16_t n) const;
   inline bool
     canShow(void) { return (micros() - endTime) >= 300L; }
+  // Sends count pixels of a frame already encoded as the pixel buffer is (preamble, symbols,
+  // cleardown byte), e.g. a WS2812BSolidFrame in flash. The pixel buffer is left untouched
+  // and the next show() sends all of it
+  void
+    showEncoded(const uint8_t *frame, uint16_t count);
+  // Copies count pixels already encoded (WS2812B_BYTES_PER_PIXEL bytes each, no preamble) into
+  // the pixel buffer starting at pixel first, for the next show(). Brightness is not applied.
+  // As with setPixelColor(), only pixels that differ extend the prefix sent by show()
+  void
+    writeEncoded(uint16_t first, const uint8_t *encoded, uint16_t count),
+  // Copies the encoding of count pixels starting at pixel first out of the pixel buffer
+    readEncoded(uint16_t first, uint8_t *encoded, uint16_t count) const;
+  // 0 disables prefix sending, every show() sends the whole strip
+  inline void
+    setFullRefreshInterval(uint16_t ms) { fullRefreshMs = ms; }
+  // Number of pixels sent by the last show(), 0 if nothing had changed
+  inline uint16_t
+    lastSentCount(void) const { return sentCount; }
+  // Pixels the next show() has to send (the changed prefix), 0 if none changed since the last one
+  inline uint16_t
+    pendingCount(void) const { return dirtyCount; }
+
+ protected:
+
+  // Writes the encoding of all zeros to the first count pixels.
+  // Inline so that a compile time count can be unrolled (see WS2812BStatic)
+  inline void
+    clearPixels(uint16_t count)
+    {
+      waitForDma(0, numBytes);
+      uint8_t * bptr= pixels+1;// Note first byte in the buffer is a preable and is always zero. hence the +1
+      for(uint16_t i=0;i< count*3;i++)
+      {
+        for(uint8_t j=0;j<WS2812B_SYMBOL_BITS;j++)
+        {
+          *bptr++ = encoderLookup[j];
+        }
+      }
+      if(count > dirtyCount) dirtyCount = count;
+    }
+
+  // Single buffer mode: returns once DMA has read past the bytes [first, end) of the buffer or the
+  // send is over, restoring the byte zeroed past a prefix then. Nothing to wait for with two buffers
+  inline void
+    waitForDma(uint16_t first, uint16_t end)
+    {
+#if WS2812B_SINGLE_BUFFER
+      while (sendingBytes)
+      {
+        uint16_t read = sendingBytes - dma_get_count(WS2812B_DMA_DEV, WS2812B_DMA_CHANNEL);
+        if (read >= sendingBytes)
+        {
+          pixels[sendingBytes-1] = sendingSaved;
+          sendingBytes = 0;
+        }
+        else if (end <= read || first >= sendingBytes)
+        {
+          break;
+        }
+      }
+#else
+      (void)first; (void)end;
+#endif
+    }
 
 	private:
 
@@ -85,18 +142,49 @@ class WS2812B {
     begun;         // true if begin() previously called
   uint16_t
     numLEDs,       // Number of RGB LEDs in strip
-    numBytes;      // Size of 'pixels' buffer
+    numBytes,      // Size of 'pixels' buffer
+    dirtyCount,    // Pixels 0..dirtyCount-1 changed since the last show()
+    sentCount,     // Pixels sent by the last show()
+    fullRefreshMs, // Interval between full strip sends (0 = always)
+    sendingBytes;  // Single buffer mode: bytes of the send DMA may still be reading (0 = none)
 	
   uint8_t
     brightness,
    *pixels,        // Holds the current LED color values, which the external API calls interact with 9 bytes per pixel + start + end empty bytes
    *doubleBuffer,	// Holds the start of the double buffer (1 buffer for async DMA transfer and one for the API interaction.
+    sendingSaved,  // Single buffer mode: byte zeroed past the prefix being sent
     rOffset,       // Index of red byte within each 3- or 4-byte pixel
     gOffset,       // Index of green byte
     bOffset,       // Index of blue byte
     wOffset;       // Index of white byte (same as rOffset if no white)
   uint32_t
-    endTime;       // Latch timing reference
+    endTime,       // Latch timing reference
+    lastFullRefresh; // millis() of the last full strip send
+  boolean
+    ownsBuffer;    // true if doubleBuffer was malloc'd by updateLength()
+
+  void
+    setBuffer(uint16_t n, uint8_t *buffer),
+    writePixel(uint16_t n, uint8_t r, uint8_t g, uint8_t b);
+};
+
+// Storage for WS2812BStatic. A separate base so it is constructed before WS2812B
+template<uint16_t N>
+struct WS2812BStorage {
+  uint8_t storage[WS2812B_BUFFER_SIZE(N)];
+};
+
+// WS2812B with its buffer sized at compile time.
+// Declare it as a global so the buffer lands in .bss and the linker accounts for it.
+template<uint16_t N>
+class WS2812BStatic : private WS2812BStorage<N>, public WS2812B {
+ public:
+  static const uint16_t LED_COUNT = N;
+
+  WS2812BStatic() : WS2812B(N, WS2812BStorage<N>::storage) {}
+
+  void clear() { clearPixels(N); }
+  uint16_t numPixels(void) const { return N; }
 };
 
 
@@ -0,0 +1,258 @@
+/*--------------------------------------------------------------------
+  SPI bit encoding used by the WS2812B library.
+
+  Kept free of Arduino dependencies so the encoder can also be built and
+  benchmarked on the host.
+
+  The WS2812B library is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as
+  published by the Free Software Foundation, either version 3 of
+  the License, or (at your option) any later version.
+
+  See <http://www.gnu.org/licenses/>.
+  --------------------------------------------------------------------*/
+
+#ifndef WS2812B_ENCODING_H
+#define WS2812B_ENCODING_H
+
+#include <stdint.h>
+#include <string.h>
+
+// WS2812B timing windows (ns), datasheet value +/-150. Each data bit is sent as one symbol of
+// WS2812B_SYMBOL_BITS SPI bits:   3 bits: 0 = 100, 1 = 110      4 bits: 0 = 1000, 1 = 1110
+#define WS2812B_T0H_MIN_NS     250
+#define WS2812B_T0H_MAX_NS     550
+#define WS2812B_T0L_MIN_NS     700
+#define WS2812B_T0L_MAX_NS     1000
+#define WS2812B_T1H_MIN_NS     650
+#define WS2812B_T1H_MAX_NS     950
+#define WS2812B_T1L_MIN_NS     300
+#define WS2812B_T1L_MAX_NS     600
+#define WS2812B_PERIOD_MIN_NS  650
+#define WS2812B_PERIOD_MAX_NS  1850
+
+// Bit time the library used before the selection below, for clocks where nothing is in spec
+#define WS2812B_LEGACY_BIT_NS  400
+
+// Host builds (benchmarks) have no F_CPU, assume the usual 72MHz
+#ifdef F_CPU
+  #define WS2812B_F_CPU F_CPU
+#else
+  #define WS2812B_F_CPU 72000000UL
+#endif
+
+// Define WS2812B_SYMBOL_BITS as 3 or 4 to force an encoding, otherwise the one with the best margin is used
+#ifndef WS2812B_SYMBOL_BITS
+  #define WS2812B_SYMBOL_BITS_AUTO 0
+#else
+  #define WS2812B_SYMBOL_BITS_AUTO WS2812B_SYMBOL_BITS
+#endif
+
+// ==================== Divisor and encoding selection ====================
+// A candidate c is an SPI clock divisor of 2 << (c & 7) (SPI1 runs from PCLK2 = F_CPU) with
+// 3 bit symbols for c < 8 and 4 bit symbols for c >= 8.
+
+static constexpr uint8_t WS2812B_candidateBits(uint8_t c) { return c < 8 ? 3 : 4; }
+static constexpr uint16_t WS2812B_candidateDivisor(uint8_t c) { return 2 << (c & 7); }
+static constexpr uint32_t WS2812B_bitNs(uint32_t fcpu, uint16_t divisor) { return (uint32_t)(1000000000ULL * divisor / fcpu); }
+
+static constexpr int32_t WS2812B_min(int32_t a, int32_t b) { return a < b ? a : b; }
+static constexpr int32_t WS2812B_abs(int32_t a) { return a < 0 ? -a : a; }
+
+// Distance in ns from t to the nearest edge of [min, max], or -1 if outside
+static constexpr int32_t WS2812B_windowNs(uint32_t t, int32_t min, int32_t max)
+{
+  return ((int32_t)t < min || (int32_t)t > max) ? -1 : WS2812B_min((int32_t)t - min, max - (int32_t)t);
+}
+
+// Smallest distance of T0H, T0L, T1H and T1L to the edges of their windows, or -1 if any of them
+// (or the bit period) is out of spec. A 0 symbol is high for 1 bit, a 1 symbol for bits-1 bits
+static constexpr int32_t WS2812B_marginNs(uint32_t bitNs, uint8_t bits)
+{
+  return (bitNs * bits < WS2812B_PERIOD_MIN_NS || bitNs * bits > WS2812B_PERIOD_MAX_NS)
+    ? -1
+    : WS2812B_min(WS2812B_min(WS2812B_windowNs(bitNs, WS2812B_T0H_MIN_NS, WS2812B_T0H_MAX_NS),
+                              WS2812B_windowNs(bitNs * (bits - 1), WS2812B_T0L_MIN_NS, WS2812B_T0L_MAX_NS)),
+                  WS2812B_min(WS2812B_windowNs(bitNs * (bits - 1), WS2812B_T1H_MIN_NS, WS2812B_T1H_MAX_NS),
+                              WS2812B_windowNs(bitNs, WS2812B_T1L_MIN_NS, WS2812B_T1L_MAX_NS)));
+}
+
+static constexpr int32_t WS2812B_candidateMargin(uint32_t fcpu, uint8_t c, uint8_t forcedBits)
+{
+  return (forcedBits != 0 && forcedBits != WS2812B_candidateBits(c))
+    ? -1
+    : WS2812B_marginNs(WS2812B_bitNs(fcpu, WS2812B_candidateDivisor(c)), WS2812B_candidateBits(c));
+}
+
+// Largest margin wins. Candidates are visited 3 bit first and by increasing divisor, so a tie keeps
+// the smaller buffer and then the faster clock. Returns 0xFF if nothing fits.
+static constexpr uint8_t WS2812B_bestCandidate(uint32_t fcpu, uint8_t forcedBits, uint8_t c = 0, uint8_t best = 0xFF)
+{
+  return c == 16 ? best :
+    WS2812B_bestCandidate(fcpu, forcedBits, c + 1,
+      (WS2812B_candidateMargin(fcpu, c, forcedBits) >= 0 &&
+       (best == 0xFF || WS2812B_candidateMargin(fcpu, c, forcedBits) > WS2812B_candidateMargin(fcpu, best, forcedBits)))
+      ? c : best);
+}
+
+// The old fixed table: 3 bit symbols with the divisor whose bit time is closest to 400ns
+// (e.g. DIV32 at 64MHz, 500ns: T1H is 1000ns, which most strips still accept)
+static constexpr uint8_t WS2812B_legacyCandidate(uint32_t fcpu, uint8_t c = 0, uint8_t best = 0)
+{
+  return c == 8 ? best :
+    WS2812B_legacyCandidate(fcpu, c + 1,
+      WS2812B_abs((int32_t)WS2812B_bitNs(fcpu, WS2812B_candidateDivisor(c)) - WS2812B_LEGACY_BIT_NS) <
+      WS2812B_abs((int32_t)WS2812B_bitNs(fcpu, WS2812B_candidateDivisor(best)) - WS2812B_LEGACY_BIT_NS)
+      ? c : best);
+}
+
+// Clocks where no divisor puts all four times in spec fall back to the old table, unless
+// WS2812B_SYMBOL_BITS forces 4 bits
+static constexpr uint8_t WS2812B_IN_SPEC_CANDIDATE = WS2812B_bestCandidate(WS2812B_F_CPU, WS2812B_SYMBOL_BITS_AUTO);
+#define WS2812B_TIMING_IN_SPEC (WS2812B_IN_SPEC_CANDIDATE != 0xFF)
+static constexpr uint8_t WS2812B_CANDIDATE = WS2812B_TIMING_IN_SPEC ? WS2812B_IN_SPEC_CANDIDATE
+  : WS2812B_SYMBOL_BITS_AUTO == 4 ? 0xFF : WS2812B_legacyCandidate(WS2812B_F_CPU);
+static_assert(WS2812B_CANDIDATE != 0xFF, "No SPI clock divisor gives WS2812B timing for this F_CPU and WS2812B_SYMBOL_BITS");
+
+#ifndef WS2812B_SYMBOL_BITS
+  #define WS2812B_SYMBOL_BITS WS2812B_candidateBits(WS2812B_CANDIDATE)
+#endif
+static_assert(WS2812B_SYMBOL_BITS == 3 || WS2812B_SYMBOL_BITS == 4, "WS2812B_SYMBOL_BITS must be 3 or 4");
+
+// Chosen SPI clock divisor (2..256) and resulting timing
+#define WS2812B_SPI_CLOCK_DIV  WS2812B_candidateDivisor(WS2812B_CANDIDATE)
+#define WS2812B_BIT_NS         WS2812B_bitNs(WS2812B_F_CPU, WS2812B_SPI_CLOCK_DIV)
+
+// The old table only promised T0H; in spec, all four times are checked
+static_assert(WS2812B_BIT_NS >= WS2812B_T0H_MIN_NS && WS2812B_BIT_NS <= WS2812B_T0H_MAX_NS, "WS2812B T0H out of spec");
+static_assert(!WS2812B_TIMING_IN_SPEC ||
+              (WS2812B_BIT_NS * (WS2812B_SYMBOL_BITS - 1) >= WS2812B_T0L_MIN_NS &&
+               WS2812B_BIT_NS * (WS2812B_SYMBOL_BITS - 1) <= WS2812B_T0L_MAX_NS), "WS2812B T0L out of spec");
+static_assert(!WS2812B_TIMING_IN_SPEC ||
+              (WS2812B_BIT_NS * (WS2812B_SYMBOL_BITS - 1) >= WS2812B_T1H_MIN_NS &&
+               WS2812B_BIT_NS * (WS2812B_SYMBOL_BITS - 1) <= WS2812B_T1H_MAX_NS), "WS2812B T1H out of spec");
+static_assert(!WS2812B_TIMING_IN_SPEC ||
+              (WS2812B_BIT_NS >= WS2812B_T1L_MIN_NS && WS2812B_BIT_NS <= WS2812B_T1L_MAX_NS), "WS2812B T1L out of spec");
+
+// Encoded bytes per pixel (3 colour bytes of WS2812B_SYMBOL_BITS bytes each)
+#define WS2812B_BYTES_PER_PIXEL (3 * WS2812B_SYMBOL_BITS)
+
+// ==================== Lookup table generation ====================
+// Each colour value v maps to bits bytes: its 8 symbols, MSB first, packed big endian.
+
+static constexpr uint32_t WS2812B_symbol(uint8_t bits, bool one)
+{
+  // (bits-1) high bits for a one, a single high bit for a zero, then low bits
+  return one ? ((1UL << (bits - 1)) - 1) << 1 : 1UL << (bits - 1);
+}
+
+static constexpr uint32_t WS2812B_encodeValue(uint8_t bits, uint8_t v, int8_t bit = 7, uint32_t acc = 0)
+{
+  return bit < 0 ? acc : WS2812B_encodeValue(bits, v, bit - 1, (acc << bits) | WS2812B_symbol(bits, (v >> bit) & 1));
+}
+
+static constexpr uint8_t WS2812B_lutByte(uint8_t bits, unsigned i)
+{
+  return (uint8_t)(WS2812B_encodeValue(bits, i / bits) >> (8 * (bits - 1 - i % bits)));
+}
+
+// Index sequence built by halving, so 1024 entries only need ~10 levels of template recursion
+template<unsigned... I> struct WS2812BIndexSeq { typedef WS2812BIndexSeq type; };
+
+template<class A, class B> struct WS2812BConcatSeq;
+template<unsigned... A, unsigned... B>
+struct WS2812BConcatSeq<WS2812BIndexSeq<A...>, WS2812BIndexSeq<B...> > : WS2812BIndexSeq<A..., (sizeof...(A) + B)...> {};
+
+template<unsigned N> struct WS2812BMakeSeq :
+  WS2812BConcatSeq<typename WS2812BMakeSeq<N / 2>::type, typename WS2812BMakeSeq<N - N / 2>::type> {};
+template<> struct WS2812BMakeSeq<0> : WS2812BIndexSeq<> {};
+template<> struct WS2812BMakeSeq<1> : WS2812BIndexSeq<0> {};
+
+template<uint8_t Bits, class Seq> struct WS2812BLutData;
+template<uint8_t Bits, unsigned... I>
+struct WS2812BLutData<Bits, WS2812BIndexSeq<I...> > {
+  static constexpr uint8_t data[sizeof...(I)] = { WS2812B_lutByte(Bits, I)... };
+};
+template<uint8_t Bits, unsigned... I>
+constexpr uint8_t WS2812BLutData<Bits, WS2812BIndexSeq<I...> >::data[sizeof...(I)];
+
+// Lookup table for Bits bit symbols: Bits bytes per colour value, GRB bytes are looked up separately
+template<uint8_t Bits>
+struct WS2812BLut : WS2812BLutData<Bits, typename WS2812BMakeSeq<256 * Bits>::type> {};
+
+// Writes the 3*Bits encoded bytes of one pixel, in GRB order, starting at bptr
+// (memcpy of a constant size compiles to plain loads and stores)
+template<uint8_t Bits>
+static inline void WS2812B_encodePixelBits(uint8_t *bptr, uint8_t r, uint8_t g, uint8_t b)
+{
+   memcpy(bptr, WS2812BLut<Bits>::data + g*Bits, Bits);
+   memcpy(bptr + Bits, WS2812BLut<Bits>::data + r*Bits, Bits);
+   memcpy(bptr + 2*Bits, WS2812BLut<Bits>::data + b*Bits, Bits);
+}
+
+// Storage class of the table for the selected encoding. WS2812B.h declares it extern and
+// WS2812B.cpp instantiates it, so the driver links a single copy of the table
+#define WS2812B_LUT_DATA WS2812BLutData<WS2812B_SYMBOL_BITS, WS2812BMakeSeq<256 * WS2812B_SYMBOL_BITS>::type>
+
+// Table for the selected encoding (a constexpr reference takes no storage of its own)
+static constexpr const uint8_t (&encoderLookup)[256 * WS2812B_SYMBOL_BITS] = WS2812BLut<WS2812B_SYMBOL_BITS>::data;
+
+// Define WS2812B_SINGLE_BUFFER as 1 to send the pixel buffer in place instead of from a second copy
+#ifndef WS2812B_SINGLE_BUFFER
+  #define WS2812B_SINGLE_BUFFER 0
+#endif
+
+// Size in bytes of the buffer needed for n LEDs: WS2812B_BYTES_PER_PIXEL encoded bytes per pixel
+// plus the preamble and cleardown bytes, times two unless in single buffer mode
+#define WS2812B_BUFFER_SIZE(n) (((n) * WS2812B_BYTES_PER_PIXEL + 2) * (WS2812B_SINGLE_BUFFER ? 1 : 2))
+
+// Byte k of a whole encoded frame of n pixels of one colour: preamble, GRB symbols, cleardown byte
+static constexpr uint8_t WS2812B_frameByte(unsigned k, unsigned n, uint8_t r, uint8_t g, uint8_t b)
+{
+  return (k == 0 || k > n * WS2812B_BYTES_PER_PIXEL) ? 0 :
+    WS2812B_lutByte(WS2812B_SYMBOL_BITS,
+      ((k - 1) % WS2812B_BYTES_PER_PIXEL / WS2812B_SYMBOL_BITS == 0 ? g :
+       (k - 1) % WS2812B_BYTES_PER_PIXEL / WS2812B_SYMBOL_BITS == 1 ? r : b) * WS2812B_SYMBOL_BITS
+      + (k - 1) % WS2812B_SYMBOL_BITS);
+}
+
+template<uint16_t N, uint8_t R, uint8_t G, uint8_t B, class Seq> struct WS2812BFrameData;
+template<uint16_t N, uint8_t R, uint8_t G, uint8_t B, unsigned... I>
+struct WS2812BFrameData<N, R, G, B, WS2812BIndexSeq<I...> > {
+  static constexpr uint8_t data[sizeof...(I)] = { WS2812B_frameByte(I, N, R, G, B)... };
+};
+template<uint16_t N, uint8_t R, uint8_t G, uint8_t B, unsigned... I>
+constexpr uint8_t WS2812BFrameData<N, R, G, B, WS2812BIndexSeq<I...> >::data[sizeof...(I)];
+
+// Frame of N pixels of one colour, encoded at compile time and kept in flash.
+// Ready for WS2812B::showEncoded(), which DMAs it without touching the pixel buffer
+template<uint16_t N, uint8_t R, uint8_t G, uint8_t B>
+struct WS2812BSolidFrame : WS2812BFrameData<N, R, G, B, typename WS2812BMakeSeq<N * WS2812B_BYTES_PER_PIXEL + 2>::type> {};
+
+// Writes the WS2812B_BYTES_PER_PIXEL encoded bytes of one pixel, in GRB order, starting at bptr
+static inline void WS2812B_encodePixel(uint8_t *bptr, uint8_t r, uint8_t g, uint8_t b)
+{
+   WS2812B_encodePixelBits<WS2812B_SYMBOL_BITS>(bptr, r, g, b);
+}
+
+// Colour value back from its WS2812B_SYMBOL_BITS encoded bytes: the second bit of each symbol is the data bit
+static inline uint8_t WS2812B_decodeValue(const uint8_t *symbols)
+{
+   uint8_t value = 0;
+   for (uint8_t i = 0; i < 8; i++)
+   {
+     uint8_t bit = i * WS2812B_SYMBOL_BITS + 1;
+     value = (value << 1) | ((symbols[bit >> 3] >> (7 - (bit & 7))) & 1);
+   }
+   return value;
+}
+
+// Reads back the colour of one pixel encoded by WS2812B_encodePixel (GRB order)
+static inline void WS2812B_decodePixel(const uint8_t *bptr, uint8_t &r, uint8_t &g, uint8_t &b)
+{
+   g = WS2812B_decodeValue(bptr);
+   r = WS2812B_decodeValue(bptr + WS2812B_SYMBOL_BITS);
+   b = WS2812B_decodeValue(bptr + 2 * WS2812B_SYMBOL_BITS);
+}
+
+#endif // WS2812B_ENCODING_H
@@ -0,0 +1,101 @@
+# Post-build RAM/flash footprint report (PlatformIO extra script)
+#
+# Prints the flash and RAM used by the firmware image and a RAM breakdown by
+# subsystem, taken from the symbol sizes of the ELF. The build fails when a
+# total or the LED subsystem goes over the limits set for the env:
+#
+#   custom_footprint_flash_max = 65536   ; bytes of flash
+#   custom_footprint_ram_max = 18432     ; bytes of .data + .bss (the rest is stack/heap)
+#   custom_footprint_leds_ram_max = 4096 ; bytes of the "leds" group below
+#
+# A missing option (or 0) disables that check.
+
+import re
+import subprocess
+
+Import("env")
+
+# Symbol groups, matched in order against the demangled name
+GROUPS = [
+    ("frame cache", r"^frameCache$|EncodedFrameCache"),
+    ("leds", r"^leds$|WS2812B|LedController|encoderLookup"),
+    ("interpolator", r"^interpolator$|LedInterpolator"),
+    ("revbar", r"^revBar$|RevBar"),
+    ("compositor", r"^compositor$|LedCompositor"),
+    ("segments", r"^segments$|LedSegments"),
+    ("animation", r"^animation$|AnimationPlayer|ledsIdleAnimation"),
+    ("comm", r"^commSimhub$|CommSimhub|FrameFormat|Crc32"),
+    ("scheduler", r"Scheduler"),
+    ("profiler", r"Profiler|_profiler"),
+    ("usb/core", r"usb|USB|Serial|Core::|HID"),
+]
+
+FLASH_SECTIONS = (".isr_vector", ".text", ".rodata", ".ARM.extab", ".ARM.exidx",
+                  ".preinit_array", ".init_array", ".fini_array", ".data")
+RAM_SECTIONS = (".data", ".bss", ".noinit")
+
+
+def tool(name):
+    # nm lives next to the size tool of the toolchain (arm-none-eabi-size -> arm-none-eabi-nm)
+    size = env.subst("$SIZETOOL")
+    return re.sub(r"size(\.exe)?$", name + r"\1", size)
+
+
+def section_sizes(elf):
+    out = subprocess.check_output([env.subst("$SIZETOOL"), "-A", elf]).decode()
+    sizes = {}
+    for line in out.splitlines():
+        parts = line.split()
+        if len(parts) >= 2 and parts[0].startswith(".") and parts[1].isdigit():
+            sizes[parts[0]] = int(parts[1])
+    return sizes
+
+
+def ram_symbols(elf):
+    out = subprocess.check_output([tool("nm"), "-S", "-C", "--size-sort", elf]).decode(errors="replace")
+    for line in out.splitlines():
+        parts = line.split(None, 3)
+        if len(parts) == 4 and parts[2] in "bBdD":
+            yield parts[3], int(parts[1], 16)
+
+
+def group_of(name):
+    for group, pattern in GROUPS:
+        if re.search(pattern, name):
+            return group
+    return "other"
+
+
+def limit(option):
+    return int(env.GetProjectOption("custom_footprint_" + option, "0") or 0)
+
+
+def footprint(source, target, env):
+    elf = str(target[0])
+    sections = section_sizes(elf)
+    flash = sum(sections.get(s, 0) for s in FLASH_SECTIONS)
+    ram = sum(sections.get(s, 0) for s in RAM_SECTIONS)
+
+    groups = {}
+    largest = {}
+    for name, size in ram_symbols(elf):
+        group = group_of(name)
+        groups[group] = groups.get(group, 0) + size
+        if size > largest.get(group, ("", 0))[1]:
+            largest[group] = (name[:48], size)
+
+    print("Footprint [%s]: flash=%d ram=%d" % (env["PIOENV"], flash, ram))
+    for group, size in sorted(groups.items(), key=lambda item: -item[1]):
+        print("  %-12s %6d  (largest: %s %d)" % (group, size, largest[group][0], largest[group][1]))
+
+    errors = []
+    for option, used in (("flash_max", flash), ("ram_max", ram), ("leds_ram_max", groups.get("leds", 0))):
+        maximum = limit(option)
+        if maximum and used > maximum:
+            errors.append("%s %d > %d" % (option, used, maximum))
+    if errors:
+        print("Footprint over the limit: " + ", ".join(errors))
+        env.Exit(1)
+
+
+env.AddPostAction("$BUILD_DIR/${PROGNAME}.elf", footprint)
@@ -12,6 +12,10 @@
 #include <WString.h>
 
 #include "CommSimhub.h"
+#include "comm/FrameHash.h"
+#include "comm/Crc32.h"
+#include "core/Scheduler.h"
+#include <Profiler.h>
 
 String command;
 
@@ -21,15 +25,68 @@ CommSimhub::CommSimhub(ILed *leds, Stream *serialPc, Stream *serialDisplay, uint
     this->serialDisplay = serialDisplay;
     this->displayType = displayType;
     this->leds = leds;
+    this->interpolator = nullptr;
+    this->revBar = nullptr;
+    this->compositor = nullptr;
+    this->animation = nullptr;
+    this->frameCache = nullptr;
+    this->segments = nullptr;
+    this->lastFrameHash = 0;
+    this->lastFrameTime = 0;
+    this->hasLastFrame = false;
+    this->framesReceived = 0;
+    this->framesSuppressed = 0;
+    this->lastFramedSeq = 0;
+    this->hasFramedSeq = false;
+    this->framedCrcErrors = 0;
+    this->framedLengthErrors = 0;
+    this->framedSeqGaps = 0;
+    this->framedDuplicates = 0;
+    this->flowControl = false;
+    this->pendingCredits = 0;
+    this->creditShowCount = 0;
+    this->creditsSent = 0;
 }
 
 void CommSimhub::begin()
 {
+    Crc32::begin();
+}
+
+void CommSimhub::setInterpolator(LedInterpolator *interpolator)
+{
+    this->interpolator = interpolator;
+}
+
+void CommSimhub::setRevBar(RevBar *revBar)
+{
+    this->revBar = revBar;
+}
+
+void CommSimhub::setCompositor(LedCompositor *compositor)
+{
+    this->compositor = compositor;
+}
 
+void CommSimhub::setAnimationPlayer(AnimationPlayer *animation)
+{
+    this->animation = animation;
+}
+
+void CommSimhub::setFrameCache(EncodedFrameCache *frameCache)
+{
+    this->frameCache = frameCache;
+}
+
+void CommSimhub::setSegments(LedSegments *segments)
+{
+    this->segments = segments;
 }
 
 void CommSimhub::loop()
 {
+    serviceCredits();
+
     while (serialPc->available())
     {
         writeToComputer();
@@ -164,6 +221,51 @@ void CommSimhub::loop()
                 readLeds(serialPc);
             }
 
+            // Send leds data in a checked frame: payload length, sequence number and CRC-32/MPEG-2 over
+            // header and payload (zero padded to 32 bit words, big endian). Bad frames are dropped.
+            // (0xFF)(0xFF)(0xFF)(0xFF)(0xFF)(0xFF)bleds(LEN MSB)(LEN LSB)(SEQ)(0x00)(RL1)(GL1)(BL1) .... (CRC MSB)..(CRC LSB)
+            else if (command == F("bleds"))
+            {
+                readFramedLeds(serialPc);
+            }
+
+            // Select the format of the following sleds/bleds payloads, answers 1 if supported
+            // 0 = RGB888, 1 = RGB565 (big endian), 2 = RGB332, 3 = 8 bit palette index, 4 = 4 bit palette index
+            // (0xFF)(0xFF)(0xFF)(0xFF)(0xFF)(0xFF)ledfm(FORMAT)
+            else if (command == F("ledfm"))
+            {
+                readFrameFormat(serialPc);
+            }
+
+            // Upload palette entries for the palette formats, COUNT 0 = 256
+            // (0xFF)(0xFF)(0xFF)(0xFF)(0xFF)(0xFF)ledpl(START)(COUNT)(R1)(G1)(B1)(R2)(G2)(B2) ....
+            else if (command == F("ledpl"))
+            {
+                readPalette(serialPc);
+            }
+
+            // Enable (1) or disable (0) credit based flow control, answers the credits available to the host.
+            // While enabled one (0x06) is returned for each sleds/bleds frame once it is latched or dropped.
+            // (0xFF)(0xFF)(0xFF)(0xFF)(0xFF)(0xFF)flowc(ENABLE)
+            else if (command == F("flowc"))
+            {
+                readFlowControl(serialPc);
+            }
+
+            // Send compact telemetry, the rev bar is rendered on the device
+            // (0xFF)(0xFF)(0xFF)(0xFF)(0xFF)(0xFF)stelm(RPM MSB)(RPM LSB)(SHIFT MSB)(SHIFT LSB)(STATUS)(FLAG)
+            else if (command == F("stelm"))
+            {
+                readTelemetry(serialPc);
+            }
+
+            // Set the brightness and enable flag of a LED segment, answers 1 if the segment exists
+            // (0xFF)(0xFF)(0xFF)(0xFF)(0xFF)(0xFF)segcf(SEGMENT)(BRIGHTNESS)(ENABLE)
+            else if (command == F("segcf"))
+            {
+                readSegmentConfig(serialPc);
+            }
+
             // *** MATRIX ***
 
             // Get 8x8 matrix count
@@ -210,6 +312,27 @@ void CommSimhub::loop()
                 // }
             }
 
+            // Get firmware statistics
+            // (0xFF)(0xFF)(0xFF)(0xFF)(0xFF)(0xFF)stats
+            else if (command == F("stats"))
+            {
+                printStats();
+            }
+
+            // Get scheduler task timings
+            // (0xFF)(0xFF)(0xFF)(0xFF)(0xFF)(0xFF)tasks
+            else if (command == F("tasks"))
+            {
+                Scheduler::report(serialPc);
+            }
+
+            // Get profiler probes
+            // (0xFF)(0xFF)(0xFF)(0xFF)(0xFF)(0xFF)profs
+            else if (command == F("profs"))
+            {
+                Profiler::dump(serialPc);
+            }
+
             // Unlock upload
             // (0xFF)(0xFF)(0xFF)(0xFF)(0xFF)(0xFF)unloc
             else if (command == F("unloc"))
@@ -244,18 +367,228 @@ void CommSimhub::writeToComputer()
 
 void CommSimhub::readLeds(Stream *serial)
 {
-    uint8_t r, g, b;
+    PROFILE_SCOPE("readLeds");
     int ledsCount = leds->getCount();
+    if (ledsCount > LEDS_COUNT) ledsCount = LEDS_COUNT;
+
+    // Frame inteiro antes de aplicá-lo
+    readBytes(serial, ledsFrame, frameFormat.bytesFor(ledsCount));
+    applyLedsFrame(ledsCount);
+}
+
+void CommSimhub::readFramedLeds(Stream *serial)
+{
+    PROFILE_SCOPE("readFramedLeds");
+    uint8_t header[LEDS_FRAME_HEADER_SIZE];
+    readBytes(serial, header, sizeof(header));
+    uint16_t length = ((uint16_t)header[0] << 8) | header[1];
+    uint8_t seq = header[2];
+
+    // Comprimento inválido: o fim do frame é desconhecido, o parser ressincroniza pelos 0xFF
+    if (length > sizeof(ledsFrame) || header[3] != 0)
+    {
+        framedLengthErrors++;
+        frameConsumed(false);
+        return;
+    }
+
+    uint8_t crc[LEDS_FRAME_CRC_SIZE];
+    readBytes(serial, ledsFrame, length);
+    readBytes(serial, crc, sizeof(crc));
+
+    Crc32::reset();
+    Crc32::update(header, sizeof(header));
+    Crc32::update(ledsFrame, length);
+    uint32_t received = ((uint32_t)crc[0] << 24) | ((uint32_t)crc[1] << 16) | ((uint32_t)crc[2] << 8) | crc[3];
+    if (Crc32::value() != received)
+    {
+        framedCrcErrors++;
+        frameConsumed(false);
+        return;
+    }
+
+    if (hasFramedSeq)
+    {
+        if (seq == lastFramedSeq)
+        {
+            framedDuplicates++;
+            frameConsumed(false);
+            return;
+        }
+        framedSeqGaps += (uint8_t)(seq - lastFramedSeq - 1);
+    }
+    lastFramedSeq = seq;
+    hasFramedSeq = true;
+
+    applyLedsFrame(frameFormat.countFor(length));
+}
+
+void CommSimhub::applyLedsFrame(uint16_t ledsCount)
+{
+    if (ledsCount > leds->getCount()) ledsCount = leds->getCount();
+    framesReceived++;
+
+    // Frames completos voltam a ter prioridade sobre a barra de RPM e a animação. Se uma delas
+    // estava desenhando, a fita não mostra mais o último frame: o próximo não pode ser suprimido
+    if (revBar != nullptr && revBar->isActive())
+    {
+        revBar->deactivate();
+        hasLastFrame = false;
+    }
+    if (animation != nullptr)
+    {
+        if (animation->isActive()) hasLastFrame = false;
+        animation->stop();
+    }
 
-    for (int i = 0; i < ledsCount; i++)
+    // Frame igual ao último exibido: pular decodificação e envio, exceto no keep-alive
+    uint32_t hash = frameHash(ledsFrame, frameFormat.bytesFor(ledsCount));
+    uint32_t now = millis();
+    if (LEDS_FRAME_SUPPRESSION_ENABLED && hasLastFrame && hash == lastFrameHash &&
+        now - lastFrameTime < LEDS_KEEPALIVE_MS)
     {
-        r = waitAndReadOneByte(serial);
-        g = waitAndReadOneByte(serial);
-        b = waitAndReadOneByte(serial);
+        framesSuppressed++;
+        frameConsumed(false);
+        return;
+    }
+    lastFrameHash = hash;
+    lastFrameTime = now;
+    hasLastFrame = true;
+    frameConsumed(true);
+
+    // Payload expandido LED a LED direto para o destino
+    uint8_t r, g, b;
+
+    // Com interpolação o frame vira alvo e a renderização fica no loop
+    if (interpolator != nullptr)
+    {
+        interpolator->beginFrame();
+        for (uint16_t i = 0; i < ledsCount; i++)
+        {
+            frameFormat.decode(ledsFrame, i, r, g, b);
+            interpolator->setPixelColor(i, r, g, b);
+        }
+        interpolator->endFrame();
+        return;
+    }
+
+    // Com o compositor o frame vai para a sua camada e a mistura fica no loop
+    if (compositor != nullptr)
+    {
+        for (uint16_t i = 0; i < ledsCount; i++)
+        {
+            frameFormat.decode(ledsFrame, i, r, g, b);
+            compositor->setPixelColor(LEDS_COMPOSITOR_SIMHUB_LAYER, i, r, g, b);
+        }
+        return;
+    }
+
+    // Frame já visto: copiar a codificação guardada, sem decodificar
+    if (frameCache != nullptr && frameCache->load(hash, ledsCount, frameFormat.getFormat()))
+    {
+        leds->requestShow();
+        return;
+    }
+
+    for (uint16_t i = 0; i < ledsCount; i++)
+    {
+        frameFormat.decode(ledsFrame, i, r, g, b);
         leds->setPixelColor(i, r, g, b);
     }
-    leds->show();
-    delayMicroseconds(300);
+    if (frameCache != nullptr) frameCache->store(hash, ledsCount, frameFormat.getFormat());
+    // O envio e o tempo de reset ficam com a tarefa de show
+    leds->requestShow();
+}
+
+void CommSimhub::readFlowControl(Stream *serial)
+{
+    uint8_t enable;
+    readBytes(serial, &enable, 1);
+    flowControl = enable != 0;
+    pendingCredits = 0;
+    serialPc->println(flowControl ? FLOW_CONTROL_CREDITS : 0);
+}
+
+void CommSimhub::readFrameFormat(Stream *serial)
+{
+    uint8_t format;
+    readBytes(serial, &format, 1);
+    bool ok = frameFormat.setFormat(format);
+    // O mesmo payload pode representar outras cores no novo formato
+    hasLastFrame = false;
+    serialPc->println(ok ? 1 : 0);
+}
+
+void CommSimhub::readPalette(Stream *serial)
+{
+    uint8_t header[2];
+    readBytes(serial, header, sizeof(header));
+    uint16_t count = header[1] == 0 ? 256 : header[1];
+
+    // Uma entrada por vez, sem buffer para a paleta inteira
+    uint8_t rgb[3];
+    for (uint16_t i = 0; i < count; i++)
+    {
+        readBytes(serial, rgb, sizeof(rgb));
+        if (header[0] + i < 256) frameFormat.setPalette(header[0] + i, rgb, 1);
+    }
+    hasLastFrame = false;
+    // Os mesmos índices agora são outras cores
+    if (frameCache != nullptr) frameCache->invalidate();
+}
+
+void CommSimhub::frameConsumed(bool shown)
+{
+    if (!flowControl) return;
+
+    // Frame descartado não vai para a fita: devolver o crédito na hora
+    if (!shown)
+    {
+        serialPc->write((uint8_t)FLOW_CONTROL_CREDIT_BYTE);
+        creditsSent++;
+        return;
+    }
+
+    pendingCredits++;
+    creditShowCount = leds->getShowCount();
+}
+
+void CommSimhub::serviceCredits()
+{
+    // Um show() depois do último frame aplicado travou todos os frames pendentes
+    if (pendingCredits == 0 || leds->getShowCount() == creditShowCount) return;
+
+    while (pendingCredits > 0)
+    {
+        serialPc->write((uint8_t)FLOW_CONTROL_CREDIT_BYTE);
+        creditsSent++;
+        pendingCredits--;
+    }
+}
+
+void CommSimhub::readTelemetry(Stream *serial)
+{
+    uint8_t data[REVBAR_TELEMETRY_SIZE];
+    readBytes(serial, data, sizeof(data));
+    if (animation != nullptr) animation->stop();
+    if (revBar != nullptr) revBar->setTelemetry(data);
+
+    // A barra desenha por cima do último frame (e o apaga ao expirar): o próximo frame sempre vai para a fita
+    hasLastFrame = false;
+}
+
+void CommSimhub::readSegmentConfig(Stream *serial)
+{
+    uint8_t data[3];
+    readBytes(serial, data, sizeof(data));
+    if (segments == nullptr || data[0] >= segments->getCount())
+    {
+        serialPc->println(0);
+        return;
+    }
+    segments->setBrightness(data[0], data[1]);
+    segments->setEnabled(data[0], data[2] != 0);
+    serialPc->println(1);
 }
 
 int CommSimhub::waitAndReadOneByte(Stream *stream)
@@ -265,3 +598,73 @@ int CommSimhub::waitAndReadOneByte(Stream *stream)
     }
     return stream->read();
 }
+
+void CommSimhub::readBytes(Stream *serial, uint8_t *dest, uint16_t count)
+{
+    for (uint16_t i = 0; i < count; i++)
+    {
+        dest[i] = waitAndReadOneByte(serial);
+    }
+}
+
+void CommSimhub::printStats()
+{
+    serialPc->print(F("boot.first_light_us="));
+    serialPc->println(leds->getFirstLightUs());
+    serialPc->print(F("leds.frames="));
+    serialPc->println(framesReceived);
+    serialPc->print(F("leds.suppressed="));
+    serialPc->println(framesSuppressed);
+    if (compositor != nullptr)
+    {
+        serialPc->print(F("compositor.pixels="));
+        serialPc->println(compositor->getComposedPixels());
+        serialPc->print(F("compositor.pool_free="));
+        serialPc->println(compositor->poolFree());
+    }
+    if (frameCache != nullptr)
+    {
+        serialPc->print(F("cache.frames="));
+        serialPc->println(frameCache->getSlots());
+        serialPc->print(F("cache.hits="));
+        serialPc->println(frameCache->getHits());
+        serialPc->print(F("cache.misses="));
+        serialPc->println(frameCache->getMisses());
+        serialPc->print(F("cache.hit_rate="));
+        serialPc->println(frameCache->getHitRate(), 2);
+    }
+    if (segments != nullptr)
+    {
+        serialPc->print(F("segments.shows="));
+        serialPc->println(segments->getShows());
+        serialPc->print(F("segments.skipped="));
+        serialPc->println(segments->getSkipped());
+        for (uint8_t i = 0; i < segments->getCount(); i++)
+        {
+            const LedSegment *segment = segments->getSegment(i);
+            serialPc->print(F("segment."));
+            serialPc->print(segment->name);
+            serialPc->print(F(".renders="));
+            serialPc->println(segment->renders);
+        }
+    }
+    if (animation != nullptr)
+    {
+        serialPc->print(F("animation.active="));
+        serialPc->println(animation->isActive() ? 1 : 0);
+        serialPc->print(F("animation.frames="));
+        serialPc->println(animation->getFramesShown());
+    }
+    serialPc->print(F("bleds.crc_errors="));
+    serialPc->println(framedCrcErrors);
+    serialPc->print(F("bleds.length_errors="));
+    serialPc->println(framedLengthErrors);
+    serialPc->print(F("bleds.seq_gaps="));
+    serialPc->println(framedSeqGaps);
+    serialPc->print(F("bleds.duplicates="));
+    serialPc->println(framedDuplicates);
+    serialPc->print(F("flow.enabled="));
+    serialPc->println(flowControl ? 1 : 0);
+    serialPc->print(F("flow.credits_sent="));
+    serialPc->println(creditsSent);
+}
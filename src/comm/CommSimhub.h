@@ -16,6 +16,17 @@
 
 #include "constants/constants.h"
 #include "led/ILed.h"
+#include "led/LedInterpolator.h"
+#include "led/RevBar.h"
+#include "led/LedCompositor.h"
+#include "led/AnimationPlayer.h"
+#include "led/EncodedFrameCache.h"
+#include "led/LedSegments.h"
+#include "comm/FrameFormat.h"
+
+// Cabeçalho do frame bleds: comprimento (2), sequência, reservado
+#define LEDS_FRAME_HEADER_SIZE 4
+#define LEDS_FRAME_CRC_SIZE 4
 
 class CommSimhub
 {
@@ -24,13 +35,53 @@ private:
     Stream *serialDisplay;
     uint8_t displayType;
     ILed *leds;
+    LedInterpolator *interpolator;
+    RevBar *revBar;
+    LedCompositor *compositor;
+    AnimationPlayer *animation;
+    EncodedFrameCache *frameCache;
+    LedSegments *segments;
+    uint8_t ledsFrame[LEDS_COUNT * 3]; // Payload no formato recebido (até 3 bytes por LED)
+    FrameFormat frameFormat;
+    uint32_t lastFrameHash;     // Hash do último frame exibido
+    uint32_t lastFrameTime;     // millis() do último frame exibido
+    bool hasLastFrame;
+    uint32_t framesReceived;
+    uint32_t framesSuppressed;  // Frames iguais ao anterior descartados
+    uint8_t lastFramedSeq;      // Sequência do último frame bleds aceito
+    bool hasFramedSeq;
+    uint32_t framedCrcErrors;
+    uint32_t framedLengthErrors;
+    uint32_t framedSeqGaps;     // Frames perdidos (saltos de sequência)
+    uint32_t framedDuplicates;
+    bool flowControl;
+    uint8_t pendingCredits;     // Frames aplicados aguardando o envio para a fita
+    uint32_t creditShowCount;   // Contagem de show() quando o último frame foi aplicado
+    uint32_t creditsSent;
     int messageend;
     bool uploadUnlocked;
     void readLeds(Stream *serial);
+    void readFramedLeds(Stream *serial);
+    void applyLedsFrame(uint16_t ledsCount);
+    void readFlowControl(Stream *serial);
+    void readFrameFormat(Stream *serial);
+    void readPalette(Stream *serial);
+    void frameConsumed(bool shown);
+    void serviceCredits();
+    void readTelemetry(Stream *serial);
+    void readSegmentConfig(Stream *serial);
     int waitAndReadOneByte(Stream *serial);
+    void readBytes(Stream *serial, uint8_t *dest, uint16_t count);
+    void printStats();
 public:
     CommSimhub(ILed *leds, Stream *serialPc = nullptr, Stream *serialDisplay = nullptr, uint8_t displayType = 0);
     void begin();
+    void setInterpolator(LedInterpolator *interpolator);
+    void setRevBar(RevBar *revBar);
+    void setCompositor(LedCompositor *compositor);
+    void setAnimationPlayer(AnimationPlayer *animation);
+    void setFrameCache(EncodedFrameCache *frameCache);
+    void setSegments(LedSegments *segments);
     void loop();
     void writeToComputer();
 };
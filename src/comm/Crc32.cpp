@@ -0,0 +1,113 @@
+/**
+ * @file Crc32.cpp
+ * @author your name (you@domain.com)
+ * @brief CRC-32/MPEG-2 dos frames binários, com a unidade CRC do STM32
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "Crc32.h"
+
+#if CRC32_HARDWARE
+
+// Registradores do STM32F1 acessados direto: os cores não têm driver da unidade CRC
+#define CRC32_DR (*(volatile uint32_t *)0x40023000)
+#define CRC32_CR (*(volatile uint32_t *)0x40023008)
+#define CRC32_CR_RESET 0x01
+#define CRC32_RCC_AHBENR (*(volatile uint32_t *)0x40021014)
+#define CRC32_RCC_AHBENR_CRCEN (1 << 6)
+
+void Crc32::begin()
+{
+    CRC32_RCC_AHBENR |= CRC32_RCC_AHBENR_CRCEN;
+}
+
+void Crc32::reset()
+{
+    CRC32_CR = CRC32_CR_RESET;
+}
+
+void Crc32::update(const uint8_t *data, uint16_t length)
+{
+    while (length >= 4)
+    {
+        CRC32_DR = ((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3];
+        data += 4;
+        length -= 4;
+    }
+
+    if (length > 0)
+    {
+        uint32_t word = 0;
+        for (uint8_t i = 0; i < length; i++)
+        {
+            word |= (uint32_t)data[i] << (24 - 8 * i);
+        }
+        CRC32_DR = word;
+    }
+}
+
+uint32_t Crc32::value()
+{
+    return CRC32_DR;
+}
+
+#else
+
+// CRC de cada nibble alinhado aos 4 bits mais altos
+static const uint32_t nibbleTable[16] = {
+    0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9,
+    0x130476DC, 0x17C56B6B, 0x1A864DB2, 0x1E475005,
+    0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61,
+    0x350C9B64, 0x31CD86D3, 0x3C8EA00A, 0x384FBDBD,
+};
+
+uint32_t Crc32::crc = 0xFFFFFFFF;
+
+void Crc32::begin()
+{
+}
+
+void Crc32::reset()
+{
+    crc = 0xFFFFFFFF;
+}
+
+void Crc32::updateWord(uint32_t word)
+{
+    crc ^= word;
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        crc = (crc << 4) ^ nibbleTable[crc >> 28];
+    }
+}
+
+void Crc32::update(const uint8_t *data, uint16_t length)
+{
+    while (length >= 4)
+    {
+        updateWord(((uint32_t)data[0] << 24) | ((uint32_t)data[1] << 16) | ((uint32_t)data[2] << 8) | data[3]);
+        data += 4;
+        length -= 4;
+    }
+
+    if (length > 0)
+    {
+        uint32_t word = 0;
+        for (uint8_t i = 0; i < length; i++)
+        {
+            word |= (uint32_t)data[i] << (24 - 8 * i);
+        }
+        updateWord(word);
+    }
+}
+
+uint32_t Crc32::value()
+{
+    return crc;
+}
+
+#endif
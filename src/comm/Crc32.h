@@ -0,0 +1,59 @@
+/**
+ * @file Crc32.h
+ * @author your name (you@domain.com)
+ * @brief CRC-32/MPEG-2 dos frames binários, com a unidade CRC do STM32
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Polinômio 0x04C11DB7, valor inicial 0xFFFFFFFF, sem reflexão e sem XOR
+ * final: é o cálculo da unidade CRC do STM32F1, que consome palavras de 32
+ * bits. Os bytes são agrupados em palavras big endian e a última palavra é
+ * completada com zeros; o host precisa calcular da mesma forma.
+ *
+ * Sem a unidade (AVR) é usada uma tabela de 16 entradas (4 bits por vez).
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __CRC32__H__
+#define __CRC32__H__
+
+#include <Arduino.h>
+
+#if SDK_MAPLE || SDK_STM32DUINO
+#define CRC32_HARDWARE 1
+#else
+#define CRC32_HARDWARE 0
+#endif
+
+class Crc32
+{
+private:
+#if !CRC32_HARDWARE
+    static uint32_t crc;
+    static void updateWord(uint32_t word);
+#endif
+public:
+    /**
+     * @brief Habilita o clock da unidade CRC
+     */
+    static void begin();
+
+    /**
+     * @brief Reinicia o cálculo (0xFFFFFFFF)
+     */
+    static void reset();
+
+    /**
+     * @brief Acumula bytes no CRC
+     *
+     * Bytes agrupados em palavras big endian. Apenas a última chamada de um
+     * cálculo pode ter tamanho não múltiplo de 4 (completado com zeros).
+     */
+    static void update(const uint8_t *data, uint16_t length);
+
+    static uint32_t value();
+};
+
+#endif  //!__CRC32__H__
@@ -0,0 +1,75 @@
+/**
+ * @file FrameFormat.cpp
+ * @author your name (you@domain.com)
+ * @brief Formatos compactos dos frames de LEDs (RGB565, RGB332 e paleta)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "FrameFormat.h"
+
+const uint8_t FrameFormat::expand5[32] = {
+    0, 8, 16, 24, 33, 41, 49, 57, 66, 74, 82, 90, 99, 107, 115, 123,
+    132, 140, 148, 156, 165, 173, 181, 189, 198, 206, 214, 222, 231, 239, 247, 255,
+};
+
+const uint8_t FrameFormat::expand6[64] = {
+    0, 4, 8, 12, 16, 20, 24, 28, 32, 36, 40, 44, 48, 52, 56, 60,
+    65, 69, 73, 77, 81, 85, 89, 93, 97, 101, 105, 109, 113, 117, 121, 125,
+    130, 134, 138, 142, 146, 150, 154, 158, 162, 166, 170, 174, 178, 182, 186, 190,
+    195, 199, 203, 207, 211, 215, 219, 223, 227, 231, 235, 239, 243, 247, 251, 255,
+};
+
+const uint8_t FrameFormat::expand3[8] = { 0, 36, 73, 109, 146, 182, 219, 255 };
+
+const uint8_t FrameFormat::expand2[4] = { 0, 85, 170, 255 };
+
+FrameFormat::FrameFormat()
+{
+    format = FRAME_FORMAT_RGB888;
+    memset(palette, 0, sizeof(palette));
+}
+
+bool FrameFormat::setFormat(uint8_t format)
+{
+    if (format >= FRAME_FORMAT_COUNT) return false;
+    this->format = format;
+    return true;
+}
+
+void FrameFormat::setPalette(uint8_t start, const uint8_t *rgb, uint16_t count)
+{
+    for (uint16_t i = 0; i < count && start + i < LEDS_PALETTE_SIZE; i++, rgb += 3)
+    {
+        palette[start + i][0] = rgb[0];
+        palette[start + i][1] = rgb[1];
+        palette[start + i][2] = rgb[2];
+    }
+}
+
+uint16_t FrameFormat::bytesFor(uint16_t count)
+{
+    switch (format)
+    {
+    case FRAME_FORMAT_RGB565: return count * 2;
+    case FRAME_FORMAT_RGB332:
+    case FRAME_FORMAT_PAL8: return count;
+    case FRAME_FORMAT_PAL4: return (count + 1) / 2;
+    default: return count * 3;
+    }
+}
+
+uint16_t FrameFormat::countFor(uint16_t length)
+{
+    switch (format)
+    {
+    case FRAME_FORMAT_RGB565: return length / 2;
+    case FRAME_FORMAT_RGB332:
+    case FRAME_FORMAT_PAL8: return length;
+    case FRAME_FORMAT_PAL4: return length * 2;
+    default: return length / 3;
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * @file FrameFormat.h
+ * @author your name (you@domain.com)
+ * @brief Formatos compactos dos frames de LEDs (RGB565, RGB332 e paleta)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * O host escolhe o formato com o comando ledfm e, nos formatos de paleta,
+ * envia a paleta com ledpl. O payload compacto é expandido por tabelas LED
+ * a LED direto para setPixelColor, sem buffer intermediário de 24 bits.
+ *
+ * Campos de 16 bits (RGB565) são big endian; em PAL4 o nibble alto é o
+ * primeiro LED do byte.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __FRAMEFORMAT__H__
+#define __FRAMEFORMAT__H__
+
+#include <Arduino.h>
+
+#include "constants/constants.h"
+
+enum LedFrameFormat
+{
+    FRAME_FORMAT_RGB888 = 0, // 3 bytes por LED (padrão)
+    FRAME_FORMAT_RGB565,     // 2 bytes por LED
+    FRAME_FORMAT_RGB332,     // 1 byte por LED
+    FRAME_FORMAT_PAL8,       // Índice de 8 bits na paleta
+    FRAME_FORMAT_PAL4,       // Índice de 4 bits na paleta (2 LEDs por byte)
+    FRAME_FORMAT_COUNT
+};
+
+class FrameFormat
+{
+private:
+    uint8_t format;
+    uint8_t palette[LEDS_PALETTE_SIZE][3];
+
+    // Expansão dos canais para 8 bits replicando os bits mais altos
+    static const uint8_t expand5[32];
+    static const uint8_t expand6[64];
+    static const uint8_t expand3[8];
+    static const uint8_t expand2[4];
+public:
+    FrameFormat();
+
+    /**
+     * @brief Seleciona o formato dos próximos frames
+     * @return false se o formato não existe
+     */
+    bool setFormat(uint8_t format);
+    uint8_t getFormat() { return format; }
+
+    /**
+     * @brief Grava cores RGB na paleta a partir de start
+     */
+    void setPalette(uint8_t start, const uint8_t *rgb, uint16_t count);
+
+    /**
+     * @brief Bytes de payload de count LEDs no formato atual
+     */
+    uint16_t bytesFor(uint16_t count);
+
+    /**
+     * @brief LEDs contidos em length bytes de payload no formato atual
+     */
+    uint16_t countFor(uint16_t length);
+
+    /**
+     * @brief Expande o LED index do payload para RGB
+     */
+    inline void decode(const uint8_t *data, uint16_t index, uint8_t &r, uint8_t &g, uint8_t &b)
+    {
+        switch (format)
+        {
+        case FRAME_FORMAT_RGB565:
+        {
+            const uint8_t *p = data + index * 2;
+            r = expand5[p[0] >> 3];
+            g = expand6[((p[0] & 0x07) << 3) | (p[1] >> 5)];
+            b = expand5[p[1] & 0x1F];
+            break;
+        }
+        case FRAME_FORMAT_RGB332:
+        {
+            uint8_t v = data[index];
+            r = expand3[v >> 5];
+            g = expand3[(v >> 2) & 0x07];
+            b = expand2[v & 0x03];
+            break;
+        }
+        case FRAME_FORMAT_PAL8:
+        case FRAME_FORMAT_PAL4:
+        {
+            uint8_t i = format == FRAME_FORMAT_PAL8 ? data[index]
+                      : (index & 1) ? data[index >> 1] & 0x0F : data[index >> 1] >> 4;
+#if LEDS_PALETTE_SIZE < 256
+            if (i >= LEDS_PALETTE_SIZE) i = 0;
+#endif
+            r = palette[i][0];
+            g = palette[i][1];
+            b = palette[i][2];
+            break;
+        }
+        default:
+        {
+            const uint8_t *p = data + index * 3;
+            r = p[0];
+            g = p[1];
+            b = p[2];
+        }
+        }
+    }
+};
+
+#endif  //!__FRAMEFORMAT__H__
@@ -0,0 +1,33 @@
+/**
+ * @file FrameHash.h
+ * @author your name (you@domain.com)
+ * @brief Hash rápido de frames para detectar frames repetidos
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * FNV-1a de 32 bits: uma multiplicação e um XOR por byte, sem tabela.
+ * O valor pode ser continuado entre trechos passando o hash anterior.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __FRAMEHASH__H__
+#define __FRAMEHASH__H__
+
+#include <stdint.h>
+
+#define FRAME_HASH_SEED 2166136261UL
+#define FRAME_HASH_PRIME 16777619UL
+
+static inline uint32_t frameHash(const uint8_t *data, uint16_t length, uint32_t hash = FRAME_HASH_SEED)
+{
+    for (uint16_t i = 0; i < length; i++)
+    {
+        hash ^= data[i];
+        hash *= FRAME_HASH_PRIME;
+    }
+    return hash;
+}
+
+#endif  //!__FRAMEHASH__H__
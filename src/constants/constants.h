@@ -34,6 +34,11 @@
 #define TARGET_SIMHUB_DEVICE_TYPE 0
 
 
+// Number of LEDs in the strip. Buffers are sized from it at compile time.
+#ifndef LEDS_COUNT
+#define LEDS_COUNT 82
+#endif
+
 // Example "L0,L1,L2,B0,B0,B1,B1,B2,B2,B2"
 // A led or a button can be used multiple times if needed (IE if the 4 first LEDs are tied to the first button : B0,B0,B0,B0 ...
 // If nothing is specified all leds will be used as a telemetry leds.
@@ -43,6 +48,85 @@
 // Example "#FFFFFF,#FFFFFF"
 #define DEFAULT_BUTTONS_COLORS ""
 
+// Main loop task periods and budgets (us). A period of 0 runs the task whenever nothing else is due.
+#define TASK_COMM_PERIOD_US 0
+#define TASK_COMM_BUDGET_US 2000
+#define TASK_DISPLAY_PERIOD_US 1000
+#define TASK_DISPLAY_BUDGET_US 200
+#define TASK_SHOW_PERIOD_US 1000
+#define TASK_SHOW_BUDGET_US 500
+#define TASK_CORE_PERIOD_US 10000
+#define TASK_CORE_BUDGET_US 100
+
+// Frame shown from flash as soon as the LEDs are initialised, before USB and the comm stack start.
+// It stays until the first SimHub frame. Set to 0 to start with the strip off.
+#define LEDS_BOOT_FRAME_ENABLED 1
+#define LEDS_BOOT_COLOR_R 0
+#define LEDS_BOOT_COLOR_G 0
+#define LEDS_BOOT_COLOR_B 24
+
+// Skip frames identical to the last one shown (compared by hash). Set to 0 to disable.
+// A repeated frame is still shown once every LEDS_KEEPALIVE_MS.
+#define LEDS_FRAME_SUPPRESSION_ENABLED 1
+#define LEDS_KEEPALIVE_MS 1000
+
+// Credit based flow control, enabled by the host with the flowc command.
+// The host may have FLOW_CONTROL_CREDITS LED frames in flight; a credit byte is returned as each one is latched.
+#define FLOW_CONTROL_CREDITS 2
+#define FLOW_CONTROL_CREDIT_BYTE 0x06
+
+// Palette entries for the PAL8/PAL4 frame formats (ledfm/ledpl commands), 3 bytes of RAM each. At most 256.
+#define LEDS_PALETTE_SIZE 256
+
+// Temporal interpolation between SimHub frames. Set to 0 to disable.
+// Frames are crossfaded at LEDS_INTERPOLATION_REFRESH_HZ, following the measured frame interval.
+#define LEDS_INTERPOLATION_ENABLED 0
+#define LEDS_INTERPOLATION_REFRESH_HZ 200
+
+// Layered compositor: SimHub frames, local alerts and animations on separate layers. Set to 0 to disable.
+// sleds frames are drawn on LEDS_COMPOSITOR_SIMHUB_LAYER (layer 0 is the bottom one), unless interpolation is enabled.
+// The rev bar, the segments and the idle animation draw on their own layers, each covering the whole strip.
+// Layer buffers come from a pool of LEDS_COMPOSITOR_POOL_LEDS pixels, 4 bytes each.
+#define LEDS_COMPOSITOR_ENABLED 0
+#define LEDS_COMPOSITOR_LAYERS 4
+#define LEDS_COMPOSITOR_POOL_LEDS (LEDS_COUNT * LEDS_COMPOSITOR_LAYERS)
+#define LEDS_COMPOSITOR_REFRESH_HZ 200
+#define LEDS_COMPOSITOR_SIMHUB_LAYER 0
+#define LEDS_COMPOSITOR_REVBAR_LAYER 1
+#define LEDS_COMPOSITOR_SEGMENTS_LAYER 2
+#define LEDS_COMPOSITOR_ANIMATION_LAYER 3
+
+// LRU cache of encoded sleds frames, for frames that keep coming back (rev bar and flag states). Set to 0 to disable.
+// LEDS_FRAME_CACHE_BYTES of RAM are split into whole strip frames (LEDS_COUNT * 9 bytes at 72MHz), at most
+// LEDS_FRAME_CACHE_MAX_FRAMES of them. The hit rate is in the stats.
+#define LEDS_FRAME_CACHE_ENABLED 0
+#define LEDS_FRAME_CACHE_BYTES 6144
+#define LEDS_FRAME_CACHE_MAX_FRAMES 16
+
+// Pre-encoded idle animation played straight from flash (src/led/animations, rebuilt with make idle-animation).
+// Starts after LEDS_ANIMATION_IDLE_MS without SimHub frames or telemetry. Set to 0 to disable.
+#define LEDS_ANIMATION_ENABLED 0
+#define LEDS_ANIMATION_IDLE_MS 10000
+#define LEDS_ANIMATION_TASK_HZ 500
+
+// Strip segments with their own refresh rate, brightness and enable flag (LedSegments), registered in setup()
+// with segments.add(). Only due segments are redrawn, and nothing is sent unless a pixel changed. Set to 0 to disable.
+// Put fast segments at the start of the strip: only the changed prefix is sent.
+#define LEDS_SEGMENTS_ENABLED 0
+#define LEDS_SEGMENTS_MAX 6
+#define LEDS_SEGMENTS_TASK_HZ 1000
+
+// Rev bar rendered on the device from compact telemetry (stelm command). Set to 0 to disable.
+// Without telemetry for REVBAR_TIMEOUT_MS the strip is cleared and sleds frames take over again.
+#define REVBAR_ENABLED 1
+#define REVBAR_REFRESH_HZ 100
+#define REVBAR_TIMEOUT_MS 1000
+#define REVBAR_FLAG_LEDS 2
+#define REVBAR_SHIFT_BLINK_MS 100
+#define REVBAR_LIMITER_BLINK_MS 50
+#define REVBAR_PIT_BLINK_MS 250
+#define REVBAR_FLAG_BLINK_MS 300
+
 //-------------------------
 // ------- 8x8 WS2812B RGB Matrix Settings
 //-------------------------
@@ -13,6 +13,8 @@
 
 #include "STM32Arduino.h"
 
+Stream *Core::log = &Serial;
+
 static long baud = 9600;
 static long newBaud = baud;
 static uint64_t resetTime = 0;
@@ -46,5 +48,13 @@ void Core::reset(void)
     resetTime = millis() + 1000;
 }
 
+void Core::loop(void)
+{
+    if(resetTime > 0 && millis() > resetTime)
+    {
+        NVIC_SystemReset();
+    }
+}
+
 
 #endif  //!__STM32DUINO__H__
\ No newline at end of file
@@ -0,0 +1,123 @@
+/**
+ * @file Scheduler.cpp
+ * @author your name (you@domain.com)
+ * @brief Escalonador cooperativo por deadline para o loop principal
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "Scheduler.h"
+
+SchedulerTask Scheduler::tasks[SCHEDULER_MAX_TASKS];
+uint8_t Scheduler::taskCount = 0;
+uint32_t Scheduler::windowStart = 0;
+
+int8_t Scheduler::add(const char *name, TaskFunction function, uint32_t periodUs, uint32_t budgetUs)
+{
+    if (taskCount >= SCHEDULER_MAX_TASKS) return -1;
+
+    SchedulerTask *task = &tasks[taskCount];
+    memset(task, 0, sizeof(SchedulerTask));
+    task->name = name;
+    task->function = function;
+    task->periodUs = periodUs;
+    task->budgetUs = budgetUs;
+    task->deadline = micros();
+
+    if (taskCount == 0) windowStart = micros();
+    return taskCount++;
+}
+
+void Scheduler::loop()
+{
+    uint32_t now = micros();
+    SchedulerTask *next = nullptr;
+
+    // EDF: entre as tarefas vencidas, a de deadline mais antigo
+    for (uint8_t i = 0; i < taskCount; i++)
+    {
+        SchedulerTask *task = &tasks[i];
+        if ((int32_t)(now - task->deadline) < 0) continue;
+        if (next == nullptr || (int32_t)(task->deadline - next->deadline) < 0)
+        {
+            next = task;
+        }
+    }
+    if (next == nullptr) return;
+
+    uint32_t start = micros();
+    next->function();
+    uint32_t elapsed = micros() - start;
+
+    next->runs++;
+    next->totalUs += elapsed;
+    if (elapsed > next->maxUs) next->maxUs = elapsed;
+    if (next->budgetUs > 0 && elapsed > next->budgetUs) next->overruns++;
+
+    if (next->periodUs == 0)
+    {
+        next->deadline = start + elapsed;
+        return;
+    }
+
+    // Manter a cadência; se perdeu um período inteiro, ressincronizar
+    next->deadline += next->periodUs;
+    if ((int32_t)(start + elapsed - next->deadline) >= (int32_t)next->periodUs)
+    {
+        next->late++;
+        next->deadline = start + elapsed + next->periodUs;
+    }
+}
+
+void Scheduler::report(Print *out)
+{
+    uint32_t window = micros() - windowStart;
+    if (window == 0) window = 1;
+    uint32_t busy = 0;
+
+    for (uint8_t i = 0; i < taskCount; i++)
+    {
+        SchedulerTask *task = &tasks[i];
+        busy += task->totalUs;
+
+        out->print(task->name);
+        out->print(F(": runs="));
+        out->print(task->runs);
+        out->print(F(" avg="));
+        out->print(task->runs ? task->totalUs / task->runs : 0);
+        out->print(F("us max="));
+        out->print(task->maxUs);
+        out->print(F("us budget="));
+        out->print(task->budgetUs);
+        out->print(F("us overruns="));
+        out->print(task->overruns);
+        out->print(F(" late="));
+        out->print(task->late);
+        out->print(F(" load="));
+        out->print((float)task->totalUs * 100.0f / window, 2);
+        out->println(F("%"));
+    }
+
+    out->print(F("total load="));
+    out->print((float)busy * 100.0f / window, 2);
+    out->println(F("%"));
+
+    resetStats();
+}
+
+void Scheduler::resetStats()
+{
+    for (uint8_t i = 0; i < taskCount; i++)
+    {
+        SchedulerTask *task = &tasks[i];
+        task->runs = 0;
+        task->totalUs = 0;
+        task->maxUs = 0;
+        task->overruns = 0;
+        task->late = 0;
+    }
+    windowStart = micros();
+}
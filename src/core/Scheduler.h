@@ -0,0 +1,72 @@
+/**
+ * @file Scheduler.h
+ * @author your name (you@domain.com)
+ * @brief Escalonador cooperativo por deadline para o loop principal
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Cada tarefa tem um período (deadline da próxima execução) e um orçamento
+ * de tempo. A cada chamada de loop() executa a tarefa vencida com o deadline
+ * mais antigo (EDF) e mede o tempo de execução, estouros de orçamento e
+ * atrasos, para reportar a carga de CPU por tarefa.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __SCHEDULER__H__
+#define __SCHEDULER__H__
+
+#include <Arduino.h>
+
+#ifndef SCHEDULER_MAX_TASKS
+#define SCHEDULER_MAX_TASKS 10
+#endif
+
+typedef void (*TaskFunction)(void);
+
+struct SchedulerTask
+{
+    const char *name;
+    TaskFunction function;
+    uint32_t periodUs;   // 0 = executa sempre que não houver outra vencida
+    uint32_t budgetUs;   // Tempo máximo esperado por execução (0 = sem limite)
+    uint32_t deadline;   // micros() da próxima execução
+    uint32_t runs;
+    uint32_t totalUs;    // Tempo total executando na janela atual
+    uint32_t maxUs;
+    uint32_t overruns;   // Execuções acima do orçamento
+    uint32_t late;       // Execuções que perderam um período inteiro
+};
+
+class Scheduler
+{
+private:
+    static SchedulerTask tasks[SCHEDULER_MAX_TASKS];
+    static uint8_t taskCount;
+    static uint32_t windowStart;
+public:
+    /**
+     * @brief Registra uma tarefa
+     * @param name Nome exibido no relatório
+     * @param function Função da tarefa
+     * @param periodUs Período em microssegundos (0 = contínua)
+     * @param budgetUs Orçamento por execução em microssegundos (0 = sem limite)
+     * @return Índice da tarefa ou -1 se a tabela estiver cheia
+     */
+    static int8_t add(const char *name, TaskFunction function, uint32_t periodUs, uint32_t budgetUs);
+
+    /**
+     * @brief Executa a tarefa vencida com o deadline mais antigo
+     */
+    static void loop();
+
+    /**
+     * @brief Imprime execuções, tempos, estouros e carga por tarefa e reinicia a janela
+     */
+    static void report(Print *out);
+
+    static void resetStats();
+};
+
+#endif  //!__SCHEDULER__H__
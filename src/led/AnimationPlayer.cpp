@@ -0,0 +1,163 @@
+/**
+ * @file AnimationPlayer.cpp
+ * @author your name (you@domain.com)
+ * @brief Reprodução de animações pré-codificadas direto da flash
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "AnimationPlayer.h"
+
+AnimationPlayer::AnimationPlayer(ILed *leds)
+{
+    this->leds = leds;
+    this->compositor = nullptr;
+    this->layer = 0;
+    this->keyFrame = nullptr;
+    this->synced = false;
+    this->ready = false;
+    this->active = false;
+    this->frameUs = 0;
+    this->nextFrame = 0;
+    this->lastStop = 0;
+    this->framesShown = 0;
+}
+
+void AnimationPlayer::setCompositor(LedCompositor *compositor, uint8_t layer)
+{
+    this->compositor = compositor;
+    this->layer = layer;
+}
+
+bool AnimationPlayer::begin(const uint8_t *image)
+{
+    ready = false;
+    if (!reader.begin(image)) return false;
+
+    const LedAnimationHeader &header = reader.header();
+    if (header.format != LED_ANIMATION_SPI || header.symbolBits != WS2812B_SYMBOL_BITS ||
+        header.ledBytes != WS2812B_BYTES_PER_PIXEL || header.leds > leds->getCount() || header.frameMs == 0)
+    {
+        return false;
+    }
+
+    frameUs = header.frameMs * 1000UL;
+    ready = true;
+    return true;
+}
+
+void AnimationPlayer::start()
+{
+    if (!ready || active) return;
+    reader.rewind();
+    synced = false;
+    active = true;
+    nextFrame = micros();
+}
+
+void AnimationPlayer::stop()
+{
+    // Cada frame do Simhub para a animação: só limpar a camada na transição
+    if (active && compositor != nullptr) compositor->clearLayer(layer);
+    active = false;
+    lastStop = millis();
+}
+
+void AnimationPlayer::loop()
+{
+    if (!active)
+    {
+        if (!ready || LEDS_ANIMATION_IDLE_MS == 0 || millis() - lastStop < LEDS_ANIMATION_IDLE_MS) return;
+        start();
+    }
+
+    // Frame anterior ainda no fio: tentar na próxima execução
+    uint32_t now = micros();
+    if ((int32_t)(now - nextFrame) < 0 || !leds->canSend()) return;
+
+    if (compositor != nullptr)
+    {
+        composeFrame(reader.next());
+    }
+    else
+    {
+        showFrame(reader.next());
+    }
+
+    // Manter a cadência; se perdeu um frame inteiro, ressincronizar
+    nextFrame += frameUs;
+    if ((int32_t)(now - nextFrame) >= (int32_t)frameUs) nextFrame = now + frameUs;
+}
+
+void AnimationPlayer::showFrame(const LedAnimationFrame &frame)
+{
+    const LedAnimationHeader &header = reader.header();
+
+    if (frame.type == LED_ANIMATION_KEY)
+    {
+        keyFrame = frame.data;
+        leds->showEncoded(frame.data, header.leds);
+        synced = false;
+        framesShown++;
+        return;
+    }
+
+    // Delta sem trechos: o frame anterior continua na fita
+    if (frame.runs == 0) return;
+
+    // O keyframe foi direto da flash: copiá-lo antes de aplicar o primeiro delta
+    if (!synced)
+    {
+        leds->writeEncoded(0, keyFrame + header.keyOffset, header.leds);
+        synced = true;
+    }
+
+    const uint8_t *data = frame.data;
+    for (uint16_t i = 0; i < frame.runs; i++)
+    {
+        LedAnimationRun run;
+        const uint8_t *encoded = data + sizeof(LedAnimationRun);
+        data = reader.readRun(data, run);
+        leds->writeEncoded(run.first, encoded, run.count);
+    }
+    leds->requestShow();
+    framesShown++;
+}
+
+void AnimationPlayer::composeFrame(const LedAnimationFrame &frame)
+{
+    const LedAnimationHeader &header = reader.header();
+
+    if (frame.type == LED_ANIMATION_KEY)
+    {
+        decodeToLayer(0, frame.data + header.keyOffset, header.leds);
+        framesShown++;
+        return;
+    }
+
+    // A camada guarda o frame anterior: basta aplicar os trechos
+    if (frame.runs == 0) return;
+
+    const uint8_t *data = frame.data;
+    for (uint16_t i = 0; i < frame.runs; i++)
+    {
+        LedAnimationRun run;
+        const uint8_t *encoded = data + sizeof(LedAnimationRun);
+        data = reader.readRun(data, run);
+        decodeToLayer(run.first, encoded, run.count);
+    }
+    framesShown++;
+}
+
+void AnimationPlayer::decodeToLayer(uint16_t first, const uint8_t *encoded, uint16_t count)
+{
+    uint8_t r, g, b;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        WS2812B_decodePixel(encoded + i * WS2812B_BYTES_PER_PIXEL, r, g, b);
+        compositor->setPixelColor(layer, first + i, r, g, b);
+    }
+}
@@ -0,0 +1,88 @@
+/**
+ * @file AnimationPlayer.h
+ * @author your name (you@domain.com)
+ * @brief Reprodução de animações pré-codificadas direto da flash
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * A imagem (gerada pelo tools/animpack, formato SPI) já traz os frames no
+ * stream de símbolos do WS2812B, então nada é codificado na reprodução.
+ * Keyframes vão por DMA direto da flash. Um frame delta copia seus trechos já
+ * codificados sobre o buffer de pixels e o envio fica com a tarefa de show.
+ * O brilho não é aplicado aos frames.
+ *
+ * Com o compositor os frames são decodificados para a camada da animação,
+ * acima das demais, e o envio fica com o loop do compositor; o keyframe
+ * deixa de ir direto da flash. Parar a animação torna a camada transparente.
+ *
+ * A animação começa sozinha depois de LEDS_ANIMATION_IDLE_MS sem frames do
+ * Simhub (cada frame ou telemetria chama stop()).
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __ANIMATIONPLAYER__H__
+#define __ANIMATIONPLAYER__H__
+
+#include <Arduino.h>
+#include <LedAnimation.h>
+
+#include "constants/constants.h"
+#include "led/ILed.h"
+#include "led/LedCompositor.h"
+
+class AnimationPlayer
+{
+private:
+    ILed *leds;
+    LedCompositor *compositor;
+    uint8_t layer;
+    LedAnimationReader reader;
+    const uint8_t *keyFrame; // Último keyframe exibido (na flash)
+    bool synced;             // O buffer de pixels contém o frame exibido
+    bool ready;              // Imagem válida para esta fita
+    bool active;
+    uint32_t frameUs;
+    uint32_t nextFrame;      // micros() do próximo frame
+    uint32_t lastStop;       // millis() da última parada
+    uint32_t framesShown;
+
+    void showFrame(const LedAnimationFrame &frame);
+    void composeFrame(const LedAnimationFrame &frame);
+    void decodeToLayer(uint16_t first, const uint8_t *encoded, uint16_t count);
+public:
+    AnimationPlayer(ILed *leds);
+
+    /**
+     * @brief Decodifica os frames para a camada do compositor em vez de enviá-los direto
+     * @param layer Camada já configurada cobrindo a fita
+     */
+    void setCompositor(LedCompositor *compositor, uint8_t layer);
+
+    /**
+     * @brief Valida a imagem para esta fita
+     * @return false se não for uma animação SPI com a codificação do WS2812B ou tiver mais LEDs que a fita
+     */
+    bool begin(const uint8_t *image);
+
+    /**
+     * @brief Começa do primeiro frame
+     */
+    void start();
+
+    /**
+     * @brief Para a animação e reinicia a contagem para o início automático
+     */
+    void stop();
+
+    /**
+     * @brief Exibe o próximo frame quando for a hora, na taxa da imagem
+     */
+    void loop();
+
+    bool isActive() { return active; }
+    uint32_t getFramesShown() { return framesShown; }
+};
+
+#endif  //!__ANIMATIONPLAYER__H__
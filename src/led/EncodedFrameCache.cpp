@@ -0,0 +1,93 @@
+/**
+ * @file EncodedFrameCache.cpp
+ * @author your name (you@domain.com)
+ * @brief Cache LRU de frames do Simhub já codificados
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "EncodedFrameCache.h"
+
+EncodedFrameCache::EncodedFrameCache(ILed *leds)
+{
+    this->leds = leds;
+    this->slotBytes = 0;
+    this->slots = 0;
+    this->useClock = 0;
+    this->hits = 0;
+    this->misses = 0;
+    memset(entries, 0, sizeof(entries));
+}
+
+bool EncodedFrameCache::begin()
+{
+    slotBytes = leds->getCount() * WS2812B_BYTES_PER_PIXEL;
+    uint32_t fit = slotBytes ? LEDS_FRAME_CACHE_BYTES / slotBytes : 0;
+    slots = fit > LEDS_FRAME_CACHE_MAX_FRAMES ? LEDS_FRAME_CACHE_MAX_FRAMES : fit;
+    invalidate();
+    return slots > 0;
+}
+
+EncodedFrameEntry *EncodedFrameCache::find(uint32_t hash, uint16_t count, uint8_t format)
+{
+    uint8_t brightness = leds->getBrightness();
+    for (uint8_t i = 0; i < slots; i++)
+    {
+        EncodedFrameEntry *entry = &entries[i];
+        if (entry->count == count && entry->hash == hash && entry->format == format && entry->brightness == brightness)
+        {
+            return entry;
+        }
+    }
+    return nullptr;
+}
+
+bool EncodedFrameCache::load(uint32_t hash, uint16_t count, uint8_t format)
+{
+    EncodedFrameEntry *entry = find(hash, count, format);
+    if (entry == nullptr)
+    {
+        misses++;
+        return false;
+    }
+
+    hits++;
+    entry->lastUse = ++useClock;
+    leds->writeEncoded(0, &pool[(entry - entries) * slotBytes], count);
+    return true;
+}
+
+void EncodedFrameCache::store(uint32_t hash, uint16_t count, uint8_t format)
+{
+    if (slots == 0 || count == 0 || count > leds->getCount()) return;
+
+    // Posição livre ou a usada há mais tempo
+    EncodedFrameEntry *entry = find(hash, count, format);
+    for (uint8_t i = 0; i < slots && entry == nullptr; i++)
+    {
+        if (entries[i].count == 0) entry = &entries[i];
+    }
+    if (entry == nullptr)
+    {
+        entry = &entries[0];
+        for (uint8_t i = 1; i < slots; i++)
+        {
+            if ((int32_t)(entries[i].lastUse - entry->lastUse) < 0) entry = &entries[i];
+        }
+    }
+
+    entry->hash = hash;
+    entry->count = count;
+    entry->format = format;
+    entry->brightness = leds->getBrightness();
+    entry->lastUse = ++useClock;
+    leds->readEncoded(0, &pool[(entry - entries) * slotBytes], count);
+}
+
+void EncodedFrameCache::invalidate()
+{
+    memset(entries, 0, sizeof(entries));
+}
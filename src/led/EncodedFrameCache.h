@@ -0,0 +1,88 @@
+/**
+ * @file EncodedFrameCache.h
+ * @author your name (you@domain.com)
+ * @brief Cache LRU de frames do Simhub já codificados
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Barras de RPM e bandeiras alternam entre poucos estados, então os mesmos
+ * frames voltam milhares de vezes por sessão. O cache guarda a codificação
+ * SPI de cada frame, indexada pelo hash do payload cru (o mesmo da supressão
+ * de frames repetidos), pela quantidade de LEDs, pelo formato e pelo brilho.
+ * Em um acerto a codificação é copiada para o buffer de pixels, sem
+ * decodificar nem codificar nenhum LED.
+ *
+ * A memória é um pool de LEDS_FRAME_CACHE_BYTES bytes, separado do buffer
+ * de pixels, dividido em posições do tamanho da fita inteira. Quando não há
+ * posição livre, a usada há mais tempo é substituída.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __ENCODEDFRAMECACHE__H__
+#define __ENCODEDFRAMECACHE__H__
+
+#include <Arduino.h>
+
+#include "constants/constants.h"
+#include "led/ILed.h"
+
+struct EncodedFrameEntry
+{
+    uint32_t hash;     // Hash do payload cru
+    uint32_t lastUse;  // Relógio de uso (LRU)
+    uint16_t count;    // LEDs do frame (0 = posição livre)
+    uint8_t format;    // LedFrameFormat do payload
+    uint8_t brightness;
+};
+
+class EncodedFrameCache
+{
+private:
+    ILed *leds;
+    EncodedFrameEntry entries[LEDS_FRAME_CACHE_MAX_FRAMES];
+    uint8_t pool[LEDS_FRAME_CACHE_BYTES];
+    uint16_t slotBytes;  // Bytes codificados da fita inteira
+    uint8_t slots;       // Posições que cabem no pool
+    uint32_t useClock;
+    uint32_t hits;
+    uint32_t misses;
+
+    EncodedFrameEntry *find(uint32_t hash, uint16_t count, uint8_t format);
+public:
+    EncodedFrameCache(ILed *leds);
+
+    /**
+     * @brief Divide o pool em posições para a fita
+     * @return false se nem um frame da fita cabe em LEDS_FRAME_CACHE_BYTES
+     */
+    bool begin();
+
+    /**
+     * @brief Em um acerto, copia a codificação do frame para o buffer de pixels
+     * @return false em uma falha (o frame deve ser escrito normalmente e depois passado a store())
+     */
+    bool load(uint32_t hash, uint16_t count, uint8_t format);
+
+    /**
+     * @brief Guarda a codificação dos count primeiros LEDs, lida do buffer de pixels
+     */
+    void store(uint32_t hash, uint16_t count, uint8_t format);
+
+    /**
+     * @brief Descarta todos os frames (ex.: a paleta mudou)
+     */
+    void invalidate();
+
+    uint8_t getSlots() { return slots; }
+    uint32_t getHits() { return hits; }
+    uint32_t getMisses() { return misses; }
+
+    /**
+     * @brief Porcentagem de frames encontrados no cache
+     */
+    float getHitRate() { return hits + misses ? hits * 100.0f / (hits + misses) : 0; }
+};
+
+#endif  //!__ENCODEDFRAMECACHE__H__
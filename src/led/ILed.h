@@ -19,20 +19,122 @@ class ILed : public WS2812B
 {
 private:
     uint16_t count;
+    bool showPending;
+    uint32_t lastShow;
+    uint32_t frameTimeUs;
+    uint32_t showCount;
+    uint32_t firstLightUs;
+
+    // Tempo de fio de sent LEDs (bytes codificados a WS2812B_BIT_NS por bit) mais o reset de 300us
+    static uint32_t wireTimeUs(uint16_t sent)
+    {
+        return ((uint32_t)sent * WS2812B_BYTES_PER_PIXEL + 2) * 8 * WS2812B_BIT_NS / 1000 + 300;
+    }
+
+    void init(uint16_t count)
+    {
+        this->count = count;
+        this->showPending = false;
+        this->lastShow = 0;
+        this->frameTimeUs = wireTimeUs(count);
+        this->showCount = 0;
+        this->firstLightUs = 0;
+    }
 public:
-    ILed(uint16_t count) : WS2812B(count) { this->count = count; }
+    ILed(uint16_t count) : WS2812B(count) { init(count); }
+    ILed(uint16_t count, uint8_t *buffer) : WS2812B(count, buffer) { init(count); }
 
     void begin()
     { 
         WS2812B::begin();
         WS2812B::show();
+        firstLightUs = micros();
+    }
+
+    /**
+     * @brief Inicia a fita já exibindo um frame codificado (ex.: WS2812BSolidFrame em flash)
+     *
+     * O frame é enviado por DMA direto da flash, sem codificar nada, e o
+     * buffer de pixels continua apagado até o primeiro frame do Simhub.
+     */
+    void begin(const uint8_t *bootFrame)
+    {
+        WS2812B::begin();
+        WS2812B::showEncoded(bootFrame, count);
+        firstLightUs = micros();
     }
 
     void setBrightness(uint8_t brightness) { WS2812B::setBrightness(brightness); }
-    void setPixelColor(uint8_t id, uint8_t r, uint8_t g, uint8_t b) { WS2812B::setPixelColor(id, r, g, b); }
-    void show() { WS2812B::show(); }
+    void setPixelColor(uint16_t id, uint8_t r, uint8_t g, uint8_t b) { WS2812B::setPixelColor(id, r, g, b); }
+    // O WS2812B envia só o prefixo alterado: a próxima janela depende do que foi enviado
+    void show()
+    {
+        WS2812B::show();
+        lastShow = micros();
+        frameTimeUs = lastSentCount() ? wireTimeUs(lastSentCount()) : 0;
+        showPending = false;
+        showCount++;
+    }
+
+    /**
+     * @brief Envia um frame já codificado (ex.: keyframe de animação na flash), com a mesma contabilidade do show()
+     */
+    void showEncoded(const uint8_t *frame, uint16_t count)
+    {
+        WS2812B::showEncoded(frame, count);
+        lastShow = micros();
+        frameTimeUs = wireTimeUs(lastSentCount());
+        showPending = false;
+        showCount++;
+    }
+
+    /**
+     * @brief Marca o frame para ser enviado pela tarefa de show
+     */
+    void requestShow() { showPending = true; }
+
+    /**
+     * @brief Envia o frame pendente quando o anterior já terminou e travou
+     * @return true se enviou
+     */
+    bool update()
+    {
+        if (!showPending || !canSend()) return false;
+        show();
+        return true;
+    }
+
+    /**
+     * @brief O frame anterior já terminou de ser enviado e travou
+     */
+    bool canSend() { return micros() - lastShow >= frameTimeUs; }
 
     uint16_t getCount() { return count; }
+
+    /**
+     * @brief Quantidade de frames enviados (travados na fita) desde o início
+     */
+    uint32_t getShowCount() { return showCount; }
+
+    /**
+     * @brief micros() em que o primeiro frame começou a ser enviado (tempo desde o boot)
+     */
+    uint32_t getFirstLightUs() { return firstLightUs; }
+};
+
+/**
+ * @brief ILed com buffer dimensionado em tempo de compilação
+ *
+ * Declarado como global, o buffer fica em memória estática e o uso de RAM
+ * aparece no relatório do linker, sem alocação no heap.
+ */
+template<uint16_t N>
+class StaticLed : private WS2812BStorage<N>, public ILed
+{
+public:
+    StaticLed() : ILed(N, WS2812BStorage<N>::storage) {}
+
+    void clear() { clearPixels(N); }
 };
 
 #endif  //!__ILED__H__
\ No newline at end of file
@@ -0,0 +1,182 @@
+/**
+ * @file LedCompositor.cpp
+ * @author your name (you@domain.com)
+ * @brief Composição de camadas (frames do Simhub, alertas locais, animações)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "LedCompositor.h"
+
+LedCompositor::LedCompositor(ILed *leds)
+{
+    this->leds = leds;
+    this->count = leds->getCount();
+    this->poolUsed = 0;
+    this->composedPixels = 0;
+    memset(layers, 0, sizeof(layers));
+}
+
+bool LedCompositor::setLayer(uint8_t layer, uint16_t start, uint16_t count, LedBlendMode blend)
+{
+    if (layer >= LEDS_COMPOSITOR_LAYERS || count == 0 || start >= this->count || count > this->count - start)
+        return false;
+
+    LedLayer *l = &layers[layer];
+    if (count > l->capacity)
+    {
+        // Posições novas no fim do pool (as antigas ficam sem uso)
+        if (count > LEDS_COMPOSITOR_POOL_LEDS - poolUsed) return false;
+        l->pixels = &pool[poolUsed];
+        l->capacity = count;
+        poolUsed += count;
+    }
+
+    // O trecho antigo precisa ser remisturado sem a camada
+    if (l->count > 0) markAll(l);
+
+    l->start = start;
+    l->count = count;
+    l->blend = blend;
+    l->opacity = 255;
+    l->enabled = true;
+    memset(l->pixels, 0, count * sizeof(Color));
+    markAll(l);
+    return true;
+}
+
+void LedCompositor::setOpacity(uint8_t layer, uint8_t opacity)
+{
+    if (layer >= LEDS_COMPOSITOR_LAYERS || layers[layer].opacity == opacity) return;
+    layers[layer].opacity = opacity;
+    markAll(&layers[layer]);
+}
+
+void LedCompositor::setBlendMode(uint8_t layer, LedBlendMode blend)
+{
+    if (layer >= LEDS_COMPOSITOR_LAYERS || layers[layer].blend == blend) return;
+    layers[layer].blend = blend;
+    markAll(&layers[layer]);
+}
+
+void LedCompositor::setEnabled(uint8_t layer, bool enabled)
+{
+    if (layer >= LEDS_COMPOSITOR_LAYERS || layers[layer].enabled == enabled) return;
+    layers[layer].enabled = enabled;
+    markAll(&layers[layer]);
+}
+
+bool LedCompositor::setPixelColor(uint8_t layer, uint16_t id, uint8_t r, uint8_t g, uint8_t b, uint8_t alpha)
+{
+    if (layer >= LEDS_COMPOSITOR_LAYERS) return false;
+    LedLayer *l = &layers[layer];
+    if (id < l->start || id - l->start >= l->count) return false;
+
+    // Transparente é sempre 0, independente da cor
+    Color color = alpha ? ((uint32_t)alpha << 24) | LedController::Color_RGB(r, g, b) : 0;
+    Color *pixel = &l->pixels[id - l->start];
+    if (*pixel == color) return false;
+    *pixel = color;
+    markDirty(l, id, id + 1);
+    return true;
+}
+
+void LedCompositor::clearLayer(uint8_t layer)
+{
+    if (layer >= LEDS_COMPOSITOR_LAYERS || layers[layer].count == 0) return;
+    memset(layers[layer].pixels, 0, layers[layer].count * sizeof(Color));
+    markAll(&layers[layer]);
+}
+
+void LedCompositor::markDirty(LedLayer *layer, uint16_t first, uint16_t end)
+{
+    if (first >= end) return;
+    if (layer->dirtyStart >= layer->dirtyEnd)
+    {
+        layer->dirtyStart = first;
+        layer->dirtyEnd = end;
+        return;
+    }
+    if (first < layer->dirtyStart) layer->dirtyStart = first;
+    if (end > layer->dirtyEnd) layer->dirtyEnd = end;
+}
+
+void LedCompositor::composePixel(uint16_t id)
+{
+    uint8_t r = 0, g = 0, b = 0;
+
+    for (uint8_t i = 0; i < LEDS_COMPOSITOR_LAYERS; i++)
+    {
+        LedLayer *l = &layers[i];
+        if (!l->enabled || id < l->start || id - l->start >= l->count) continue;
+
+        Color pixel = l->pixels[id - l->start];
+        uint8_t alpha = scale(pixel >> 24, l->opacity);
+        if (alpha == 0) continue;
+
+        uint8_t sr = (pixel >> 16) & 0xFF;
+        uint8_t sg = (pixel >> 8) & 0xFF;
+        uint8_t sb = pixel & 0xFF;
+
+        switch (l->blend)
+        {
+        case LED_BLEND_ADD:
+            r = addSaturated(r, scale(sr, alpha));
+            g = addSaturated(g, scale(sg, alpha));
+            b = addSaturated(b, scale(sb, alpha));
+            break;
+        case LED_BLEND_MAX:
+            r = maxOf(r, scale(sr, alpha));
+            g = maxOf(g, scale(sg, alpha));
+            b = maxOf(b, scale(sb, alpha));
+            break;
+        default:
+            r = r + (((sr - r) * (alpha + 1)) >> 8);
+            g = g + (((sg - g) * (alpha + 1)) >> 8);
+            b = b + (((sb - b) * (alpha + 1)) >> 8);
+        }
+    }
+
+    leds->setPixelColor(id, r, g, b);
+}
+
+bool LedCompositor::compose()
+{
+    bool written = false;
+
+    // Um pixel depende de todas as camadas: remisturar o trecho alterado de
+    // cada camada, pulando os pixels já cobertos pelo trecho de uma camada anterior
+    for (uint8_t i = 0; i < LEDS_COMPOSITOR_LAYERS; i++)
+    {
+        LedLayer *l = &layers[i];
+        if (l->dirtyStart >= l->dirtyEnd) continue;
+
+        for (uint16_t id = l->dirtyStart; id < l->dirtyEnd; id++)
+        {
+            bool done = false;
+            for (uint8_t j = 0; j < i && !done; j++)
+            {
+                done = id >= layers[j].dirtyStart && id < layers[j].dirtyEnd;
+            }
+            if (done) continue;
+            composePixel(id);
+            composedPixels++;
+        }
+        written = true;
+    }
+
+    for (uint8_t i = 0; i < LEDS_COMPOSITOR_LAYERS; i++)
+    {
+        layers[i].dirtyStart = layers[i].dirtyEnd = 0;
+    }
+    return written;
+}
+
+void LedCompositor::loop()
+{
+    // O envio e o tempo de reset ficam com a tarefa de show
+    if (compose()) leds->requestShow();
+}
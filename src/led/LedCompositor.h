@@ -0,0 +1,112 @@
+/**
+ * @file LedCompositor.h
+ * @author your name (you@domain.com)
+ * @brief Composição de camadas (frames do Simhub, alertas locais, animações)
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Cada camada cobre um trecho da fita com seu próprio buffer, opacidade e
+ * modo de mistura, e a camada 0 fica embaixo. Os buffers saem de um pool de
+ * LEDS_COMPOSITOR_POOL_LEDS pixels, então uma camada de alerta de 8 LEDs
+ * ocupa só 8 posições.
+ *
+ * Cada pixel de camada guarda o alpha no byte alto (0 = transparente). Cada
+ * camada registra o trecho alterado desde a última composição, e compose()
+ * remistura só esses trechos. O WS2812B compara cada pixel escrito e
+ * recodifica apenas os que mudaram.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __LEDCOMPOSITOR__H__
+#define __LEDCOMPOSITOR__H__
+
+#include <Arduino.h>
+#include <LedController.h>
+
+#include "constants/constants.h"
+#include "led/ILed.h"
+
+enum LedBlendMode
+{
+    LED_BLEND_NORMAL = 0, // Cobre as camadas de baixo proporcionalmente ao alpha
+    LED_BLEND_ADD,        // Soma saturada
+    LED_BLEND_MAX,        // Maior valor por canal
+};
+
+struct LedLayer
+{
+    Color *pixels;      // Pixels do trecho, alpha no byte alto
+    uint16_t capacity;  // Posições reservadas no pool
+    uint16_t start;     // Primeiro LED coberto
+    uint16_t count;     // LEDs cobertos (0 = camada não configurada)
+    uint8_t opacity;
+    uint8_t blend;      // LedBlendMode
+    bool enabled;
+    uint16_t dirtyStart; // Trecho alterado desde a última composição [dirtyStart, dirtyEnd)
+    uint16_t dirtyEnd;
+};
+
+class LedCompositor
+{
+private:
+    ILed *leds;
+    uint16_t count;
+    LedLayer layers[LEDS_COMPOSITOR_LAYERS];
+    Color pool[LEDS_COMPOSITOR_POOL_LEDS];
+    uint16_t poolUsed;
+    uint32_t composedPixels; // Pixels remisturados desde o início
+
+    void markDirty(LedLayer *layer, uint16_t first, uint16_t end);
+    void markAll(LedLayer *layer) { markDirty(layer, layer->start, layer->start + layer->count); }
+    static uint8_t scale(uint8_t value, uint8_t amount) { return ((uint16_t)value * (amount + 1)) >> 8; }
+    static uint8_t addSaturated(uint8_t a, uint8_t b) { return a + b > 255 ? 255 : a + b; }
+    static uint8_t maxOf(uint8_t a, uint8_t b) { return a > b ? a : b; }
+    void composePixel(uint16_t id);
+public:
+    LedCompositor(ILed *leds);
+
+    /**
+     * @brief Configura o trecho coberto por uma camada
+     *
+     * A camada começa transparente. Reconfigurar reaproveita as posições
+     * já reservadas quando o novo trecho cabe nelas.
+     *
+     * @return false se a camada não existir, o trecho sair da fita ou o pool não comportar
+     */
+    bool setLayer(uint8_t layer, uint16_t start, uint16_t count, LedBlendMode blend = LED_BLEND_NORMAL);
+
+    void setOpacity(uint8_t layer, uint8_t opacity);
+    void setBlendMode(uint8_t layer, LedBlendMode blend);
+    void setEnabled(uint8_t layer, bool enabled);
+
+    /**
+     * @brief Define um pixel da camada
+     * @param id Índice do LED na fita (fora do trecho da camada é ignorado)
+     * @param alpha Cobertura do pixel (0 = transparente)
+     * @return true se o pixel da camada mudou
+     */
+    bool setPixelColor(uint8_t layer, uint16_t id, uint8_t r, uint8_t g, uint8_t b, uint8_t alpha = 255);
+
+    /**
+     * @brief Torna a camada inteira transparente
+     */
+    void clearLayer(uint8_t layer);
+
+    /**
+     * @brief Remistura os trechos alterados e escreve na fita
+     * @return true se algum pixel foi escrito
+     */
+    bool compose();
+
+    /**
+     * @brief Compõe e solicita o envio quando algo mudou
+     */
+    void loop();
+
+    uint16_t poolFree() { return LEDS_COMPOSITOR_POOL_LEDS - poolUsed; }
+    uint32_t getComposedPixels() { return composedPixels; }
+};
+
+#endif  //!__LEDCOMPOSITOR__H__
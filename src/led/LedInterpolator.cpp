@@ -0,0 +1,95 @@
+/**
+ * @file LedInterpolator.cpp
+ * @author your name (you@domain.com)
+ * @brief Interpolação temporal entre frames recebidos do Simhub
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "LedInterpolator.h"
+
+// Limites do intervalo medido entre frames (us)
+#define INTERPOLATION_MAX_INTERVAL 250000UL
+#define INTERPOLATION_DEFAULT_INTERVAL 33333UL
+
+LedInterpolator::LedInterpolator(ILed *leds, uint16_t refreshHz)
+{
+    this->leds = leds;
+    this->count = leds->getCount() < LEDS_COUNT ? leds->getCount() : LEDS_COUNT;
+    this->refreshUs = 1000000UL / refreshHz;
+    this->frameStart = 0;
+    this->frameInterval = INTERPOLATION_DEFAULT_INTERVAL;
+    this->lastRender = 0;
+    this->hasFrame = false;
+    this->done = true;
+}
+
+bool LedInterpolator::begin()
+{
+    memset(from, 0, sizeof(from));
+    memset(to, 0, sizeof(to));
+    return leds->getCount() <= LEDS_COUNT;
+}
+
+uint16_t LedInterpolator::progress(uint32_t now)
+{
+    uint32_t elapsed = now - frameStart;
+    if (elapsed >= frameInterval) return 256;
+    return (uint16_t)((elapsed << 8) / frameInterval);
+}
+
+void LedInterpolator::beginFrame()
+{
+    // A cor exibida agora vira a origem da próxima transição
+    uint16_t amount = progress(micros());
+    for (uint16_t i = 0; i < count; i++)
+    {
+        from[i] = amount >= 256 ? to[i] : LedController::blend(from[i], to[i], amount);
+    }
+}
+
+void LedInterpolator::setPixelColor(uint16_t id, uint8_t r, uint8_t g, uint8_t b)
+{
+    if (id >= count) return;
+    to[id] = LedController::Color_RGB(r, g, b);
+}
+
+void LedInterpolator::endFrame()
+{
+    uint32_t now = micros();
+
+    if (hasFrame)
+    {
+        // Média móvel exponencial (1/8) do intervalo entre frames
+        uint32_t measured = now - frameStart;
+        if (measured < refreshUs) measured = refreshUs;
+        if (measured > INTERPOLATION_MAX_INTERVAL) measured = INTERPOLATION_MAX_INTERVAL;
+        frameInterval = frameInterval - (frameInterval >> 3) + (measured >> 3);
+    }
+
+    frameStart = now;
+    hasFrame = true;
+    done = false;
+}
+
+void LedInterpolator::loop()
+{
+    if (done) return;
+
+    uint32_t now = micros();
+    if (now - lastRender < refreshUs) return;
+    lastRender = now;
+
+    uint16_t amount = progress(now);
+    for (uint16_t i = 0; i < count; i++)
+    {
+        Color c = amount >= 256 ? to[i] : LedController::blend(from[i], to[i], amount);
+        leds->setPixelColor(i, (c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF);
+    }
+    leds->requestShow();
+
+    done = amount >= 256;
+}
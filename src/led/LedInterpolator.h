@@ -0,0 +1,72 @@
+/**
+ * @file LedInterpolator.h
+ * @author your name (you@domain.com)
+ * @brief Interpolação temporal entre frames recebidos do Simhub
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * O Simhub envia frames a 30-60 Hz com jitter, enquanto a fita consegue
+ * atualizar centenas de vezes por segundo. O interpolador guarda o frame
+ * de origem e o frame alvo e renderiza frames intermediários em uma taxa
+ * fixa, fazendo crossfade por canal com LedController::blend.
+ *
+ * O tempo de transição acompanha o intervalo medido entre frames.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __LEDINTERPOLATOR__H__
+#define __LEDINTERPOLATOR__H__
+
+#include <Arduino.h>
+#include <LedController.h>
+
+#include "constants/constants.h"
+#include "led/ILed.h"
+
+class LedInterpolator
+{
+private:
+    ILed *leds;
+    uint16_t count;
+    Color from[LEDS_COUNT]; // Frame de origem (cor exibida quando o alvo chegou)
+    Color to[LEDS_COUNT];   // Frame alvo (último frame recebido)
+    uint32_t refreshUs;     // Período de renderização
+    uint32_t frameStart;    // micros() de chegada do frame alvo
+    uint32_t frameInterval; // Intervalo médio entre frames (us)
+    uint32_t lastRender;
+    bool hasFrame;
+    bool done;              // Frame alvo já foi renderizado por completo
+
+    uint16_t progress(uint32_t now);
+public:
+    LedInterpolator(ILed *leds, uint16_t refreshHz);
+
+    /**
+     * @brief Zera os buffers de origem e alvo
+     * @return true se a fita cabe nos buffers (LEDS_COUNT)
+     */
+    bool begin();
+
+    /**
+     * @brief Inicia a recepção de um novo frame alvo
+     *
+     * Congela a cor exibida no momento como nova origem, para que um frame
+     * que chega no meio da transição não cause salto.
+     */
+    void beginFrame();
+    void setPixelColor(uint16_t id, uint8_t r, uint8_t g, uint8_t b);
+
+    /**
+     * @brief Finaliza o frame alvo e atualiza o intervalo médio entre frames
+     */
+    void endFrame();
+
+    /**
+     * @brief Renderiza um frame intermediário quando o período de atualização vence
+     */
+    void loop();
+};
+
+#endif  //!__LEDINTERPOLATOR__H__
@@ -0,0 +1,160 @@
+/**
+ * @file LedSegments.cpp
+ * @author your name (you@domain.com)
+ * @brief Segmentos da fita com taxa de atualização, brilho e habilitação próprios
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "LedSegments.h"
+
+LedSegments::LedSegments(ILed *leds)
+{
+    this->leds = leds;
+    this->compositor = nullptr;
+    this->layer = 0;
+    this->changed = false;
+    this->segmentCount = 0;
+    this->shows = 0;
+    this->skipped = 0;
+    memset(segments, 0, sizeof(segments));
+}
+
+void LedSegments::setCompositor(LedCompositor *compositor, uint8_t layer)
+{
+    this->compositor = compositor;
+    this->layer = layer;
+}
+
+int8_t LedSegments::add(const char *name, uint16_t start, uint16_t count, uint16_t refreshHz, LedSegmentRender render)
+{
+    if (segmentCount >= LEDS_SEGMENTS_MAX || refreshHz == 0 || count == 0 ||
+        start >= leds->getCount() || count > leds->getCount() - start)
+    {
+        return -1;
+    }
+
+    LedSegment *segment = &segments[segmentCount];
+    segment->name = name;
+    segment->start = start;
+    segment->count = count;
+    segment->periodUs = 1000000UL / refreshHz;
+    segment->brightness = 255;
+    segment->enabled = true;
+    segment->render = render;
+    segment->deadline = micros();
+    segment->renders = 0;
+    return segmentCount++;
+}
+
+int8_t LedSegments::find(const char *name)
+{
+    for (uint8_t i = 0; i < segmentCount; i++)
+    {
+        if (strcmp(segments[i].name, name) == 0) return i;
+    }
+    return -1;
+}
+
+void LedSegments::setBrightness(uint8_t segment, uint8_t brightness)
+{
+    if (segment >= segmentCount || segments[segment].brightness == brightness) return;
+    segments[segment].brightness = brightness;
+    segments[segment].deadline = micros();
+}
+
+void LedSegments::setEnabled(uint8_t segment, bool enabled)
+{
+    if (segment >= segmentCount || segments[segment].enabled == enabled) return;
+    LedSegment *s = &segments[segment];
+    s->enabled = enabled;
+    s->deadline = micros();
+    if (enabled) return;
+
+    clearSegment(s);
+}
+
+void LedSegments::setPixelColor(uint8_t segment, uint16_t index, uint8_t r, uint8_t g, uint8_t b)
+{
+    if (segment >= segmentCount) return;
+    LedSegment *s = &segments[segment];
+    if (index >= s->count) return;
+
+    if (s->brightness != 255)
+    {
+        r = scale(r, s->brightness);
+        g = scale(g, s->brightness);
+        b = scale(b, s->brightness);
+    }
+    if (compositor != nullptr)
+    {
+        if (compositor->setPixelColor(layer, s->start + index, r, g, b)) changed = true;
+        return;
+    }
+    leds->setPixelColor(s->start + index, r, g, b);
+}
+
+void LedSegments::fill(LedSegment *segment, uint8_t r, uint8_t g, uint8_t b)
+{
+    for (uint16_t i = 0; i < segment->count; i++)
+    {
+        leds->setPixelColor(segment->start + i, r, g, b);
+    }
+}
+
+void LedSegments::clearSegment(LedSegment *segment)
+{
+    if (compositor != nullptr)
+    {
+        // Transparente: as camadas de baixo voltam a aparecer
+        for (uint16_t i = 0; i < segment->count; i++)
+        {
+            compositor->setPixelColor(layer, segment->start + i, 0, 0, 0, 0);
+        }
+        return;
+    }
+
+    fill(segment, 0, 0, 0);
+    if (leds->pendingCount() > 0) leds->requestShow();
+}
+
+void LedSegments::loop()
+{
+    uint32_t now = micros();
+    uint32_t nowMs = millis();
+    bool rendered = false;
+    changed = false;
+
+    for (uint8_t i = 0; i < segmentCount; i++)
+    {
+        LedSegment *segment = &segments[i];
+        if (!segment->enabled || segment->render == nullptr) continue;
+        if ((int32_t)(now - segment->deadline) < 0) continue;
+
+        segment->render(this, i, nowMs);
+        segment->renders++;
+        rendered = true;
+
+        // Manter a cadência; se perdeu um período inteiro, ressincronizar
+        segment->deadline += segment->periodUs;
+        if ((int32_t)(now - segment->deadline) >= (int32_t)segment->periodUs)
+        {
+            segment->deadline = now + segment->periodUs;
+        }
+    }
+    if (!rendered) return;
+
+    // Só os pixels que mudaram contam: redesenhar as mesmas cores não vai para o fio
+    if (compositor != nullptr ? changed : leds->pendingCount() > 0)
+    {
+        shows++;
+        if (compositor == nullptr) leds->requestShow();
+    }
+    else
+    {
+        skipped++;
+    }
+}
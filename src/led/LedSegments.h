@@ -0,0 +1,117 @@
+/**
+ * @file LedSegments.h
+ * @author your name (you@domain.com)
+ * @brief Segmentos da fita com taxa de atualização, brilho e habilitação próprios
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * A fita mistura luzes de RPM rápidas, iluminação de botões lenta e LEDs de
+ * ambiente. Cada segmento cobre um trecho de índices, tem nome, taxa alvo,
+ * brilho e uma função de renderização, e só é redesenhado quando vence o
+ * seu período. O envio só é pedido quando algum pixel realmente mudou: como
+ * o WS2812B envia apenas o prefixo alterado, segmentos rápidos no começo da
+ * fita mantêm os envios curtos, e um segmento lento que redesenha as mesmas
+ * cores não gera tráfego nenhum.
+ *
+ * Com o compositor os segmentos desenham na sua camada, um segmento
+ * desabilitado fica transparente e o envio fica com o loop do compositor.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __LEDSEGMENTS__H__
+#define __LEDSEGMENTS__H__
+
+#include <Arduino.h>
+
+#include "constants/constants.h"
+#include "led/ILed.h"
+#include "led/LedCompositor.h"
+
+class LedSegments;
+
+/**
+ * @brief Desenha um segmento com LedSegments::setPixelColor()
+ * @param now millis() da renderização, para fases de animação
+ */
+typedef void (*LedSegmentRender)(LedSegments *segments, uint8_t segment, uint32_t now);
+
+struct LedSegment
+{
+    const char *name;
+    uint16_t start;
+    uint16_t count;
+    uint32_t periodUs;
+    uint8_t brightness;
+    bool enabled;
+    LedSegmentRender render;
+    uint32_t deadline;   // micros() da próxima renderização
+    uint32_t renders;
+};
+
+class LedSegments
+{
+private:
+    ILed *leds;
+    LedCompositor *compositor;
+    uint8_t layer;
+    bool changed;        // Algum pixel da camada mudou na passada (com o compositor)
+    LedSegment segments[LEDS_SEGMENTS_MAX];
+    uint8_t segmentCount;
+    uint32_t shows;      // Passadas com pixels alterados (envio pedido)
+    uint32_t skipped;    // Passadas que renderizaram sem alterar nada (sem envio)
+
+    static uint8_t scale(uint8_t value, uint8_t amount) { return ((uint16_t)value * (amount + 1)) >> 8; }
+    void fill(LedSegment *segment, uint8_t r, uint8_t g, uint8_t b);
+    void clearSegment(LedSegment *segment);
+public:
+    LedSegments(ILed *leds);
+
+    /**
+     * @brief Desenha na camada do compositor em vez de direto na fita
+     * @param layer Camada já configurada cobrindo a fita
+     */
+    void setCompositor(LedCompositor *compositor, uint8_t layer);
+
+    /**
+     * @brief Registra um segmento, habilitado e com brilho máximo
+     * @param name Nome exibido nas estatísticas
+     * @param refreshHz Taxa de renderização
+     * @return Índice do segmento ou -1 se a tabela estiver cheia ou o trecho sair da fita
+     */
+    int8_t add(const char *name, uint16_t start, uint16_t count, uint16_t refreshHz, LedSegmentRender render);
+
+    /**
+     * @brief Índice do segmento com esse nome ou -1
+     */
+    int8_t find(const char *name);
+
+    /**
+     * @brief Define o brilho do segmento e o redesenha na próxima passada
+     */
+    void setBrightness(uint8_t segment, uint8_t brightness);
+
+    /**
+     * @brief Habilita o segmento ou apaga seus LEDs (com o compositor, os torna transparentes) e para de renderizá-lo
+     */
+    void setEnabled(uint8_t segment, bool enabled);
+
+    /**
+     * @brief Define um pixel do segmento, com o brilho do segmento aplicado
+     * @param index Índice dentro do segmento (fora dele é ignorado)
+     */
+    void setPixelColor(uint8_t segment, uint16_t index, uint8_t r, uint8_t g, uint8_t b);
+
+    /**
+     * @brief Renderiza os segmentos vencidos e pede o envio se algum pixel mudou
+     */
+    void loop();
+
+    uint8_t getCount() { return segmentCount; }
+    const LedSegment *getSegment(uint8_t segment) { return segment < segmentCount ? &segments[segment] : nullptr; }
+    uint32_t getShows() { return shows; }
+    uint32_t getSkipped() { return skipped; }
+};
+
+#endif  //!__LEDSEGMENTS__H__
@@ -0,0 +1,174 @@
+/**
+ * @file RevBar.cpp
+ * @author your name (you@domain.com)
+ * @brief Barra de RPM renderizada no dispositivo a partir de telemetria compacta
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "RevBar.h"
+
+// Cores das bandeiras (RevBarFlag)
+static const uint8_t flagColors[REVBAR_FLAG_COUNT][3] = {
+    {0, 0, 0},       // Nenhuma
+    {0, 255, 0},     // Verde
+    {255, 160, 0},   // Amarela
+    {0, 0, 255},     // Azul
+    {255, 0, 0},     // Vermelha
+    {255, 255, 255}, // Branca
+    {255, 255, 255}, // Quadriculada (alterna com apagado)
+};
+
+RevBar::RevBar(ILed *leds)
+{
+    this->leds = leds;
+    this->compositor = nullptr;
+    this->layer = 0;
+    this->count = leds->getCount();
+    this->lastTelemetry = 0;
+    this->active = false;
+    memset(&telemetry, 0, sizeof(telemetry));
+}
+
+void RevBar::setCompositor(LedCompositor *compositor, uint8_t layer)
+{
+    this->compositor = compositor;
+    this->layer = layer;
+}
+
+void RevBar::deactivate()
+{
+    // Cada frame sleds desativa a barra: só limpar a camada na transição
+    if (active && compositor != nullptr) compositor->clearLayer(layer);
+    active = false;
+}
+
+void RevBar::setTelemetry(const uint8_t *data)
+{
+    telemetry.rpm = ((uint16_t)data[0] << 8) | data[1];
+    telemetry.shift = ((uint16_t)data[2] << 8) | data[3];
+    telemetry.status = data[4];
+    telemetry.flag = data[5] < REVBAR_FLAG_COUNT ? data[5] : REVBAR_FLAG_NONE;
+    lastTelemetry = millis();
+    active = true;
+}
+
+void RevBar::loop()
+{
+    if (!active) return;
+
+    uint32_t now = millis();
+    if (now - lastTelemetry > REVBAR_TIMEOUT_MS)
+    {
+        active = false;
+        if (compositor != nullptr)
+        {
+            compositor->clearLayer(layer);
+            return;
+        }
+        leds->clear();
+        leds->requestShow();
+        return;
+    }
+
+    // Barra entre as pontas reservadas às bandeiras
+    uint16_t flagLeds = count > 4 * REVBAR_FLAG_LEDS ? REVBAR_FLAG_LEDS : 0;
+    uint16_t first = flagLeds;
+    uint16_t end = count - flagLeds;
+
+    if (telemetry.status & REVBAR_STATUS_PIT)
+    {
+        // Metades alternadas
+        uint16_t middle = first + (end - first) / 2;
+        bool on = phase(now, REVBAR_PIT_BLINK_MS);
+        fillBar(first, middle, 0, 0, on ? 255 : 0);
+        fillBar(middle, end, 0, 0, on ? 0 : 255);
+    }
+    else if (telemetry.status & REVBAR_STATUS_LIMITER)
+    {
+        uint8_t red = phase(now, REVBAR_LIMITER_BLINK_MS) ? 0 : 255;
+        fillBar(first, end, red, 0, 0);
+    }
+    else if (telemetry.shift > 0 && telemetry.rpm >= telemetry.shift)
+    {
+        uint8_t blue = phase(now, REVBAR_SHIFT_BLINK_MS) ? 0 : 255;
+        fillBar(first, end, 0, 0, blue);
+    }
+    else
+    {
+        renderRpm(first, end);
+    }
+
+    renderFlag(now, 0, first);
+    renderFlag(now, end, count);
+
+    if (compositor == nullptr) leds->requestShow();
+}
+
+void RevBar::setPixel(uint16_t id, uint8_t r, uint8_t g, uint8_t b)
+{
+    if (compositor != nullptr)
+    {
+        compositor->setPixelColor(layer, id, r, g, b);
+    }
+    else
+    {
+        leds->setPixelColor(id, r, g, b);
+    }
+}
+
+void RevBar::fillBar(uint16_t first, uint16_t end, uint8_t r, uint8_t g, uint8_t b)
+{
+    for (uint16_t i = first; i < end; i++)
+    {
+        setPixel(i, r, g, b);
+    }
+}
+
+void RevBar::renderRpm(uint16_t first, uint16_t end)
+{
+    uint16_t n = end - first;
+
+    // LEDs acesos em ponto fixo 16.16: o último LED aceso recebe a fração restante
+    uint32_t level = (uint32_t)telemetry.rpm * n;
+    uint16_t lit = level >> 16;
+    uint8_t partial = (level >> 8) & 0xFF;
+
+    for (uint16_t i = 0; i < n; i++)
+    {
+        // Zonas verde, amarela e vermelha em terços da barra
+        uint8_t zone = (uint32_t)i * 3 / n;
+        uint8_t r = zone == 0 ? 0 : 255;
+        uint8_t g = zone == 2 ? 0 : (zone == 1 ? 160 : 255);
+
+        uint8_t scale = i < lit ? 255 : (i == lit ? partial : 0);
+        setPixel(first + i, (uint16_t)r * scale / 255, (uint16_t)g * scale / 255, 0);
+    }
+}
+
+void RevBar::renderFlag(uint32_t now, uint16_t first, uint16_t end)
+{
+    const uint8_t *color = flagColors[telemetry.flag];
+    bool blinkOff = telemetry.flag == REVBAR_FLAG_BLUE && phase(now, REVBAR_FLAG_BLINK_MS);
+
+    for (uint16_t i = first; i < end; i++)
+    {
+        bool off = blinkOff;
+        if (telemetry.flag == REVBAR_FLAG_CHECKERED)
+        {
+            // LEDs alternados que trocam de fase
+            off = ((i & 1) != 0) == phase(now, REVBAR_FLAG_BLINK_MS);
+        }
+        if (off)
+        {
+            setPixel(i, 0, 0, 0);
+        }
+        else
+        {
+            setPixel(i, color[0], color[1], color[2]);
+        }
+    }
+}
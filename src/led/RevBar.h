@@ -0,0 +1,109 @@
+/**
+ * @file RevBar.h
+ * @author your name (you@domain.com)
+ * @brief Barra de RPM renderizada no dispositivo a partir de telemetria compacta
+ * @version 0.1
+ * @date 2026-10-18
+ *
+ * Em vez de 3 bytes por LED, o Simhub envia apenas a fração de RPM, o ponto
+ * de troca, os limitadores e a bandeira (comando stelm). A barra, as piscadas
+ * e as bandeiras são desenhadas localmente em uma taxa fixa, com fases
+ * calculadas por millis(), sem depender do jitter do host.
+ *
+ * Prioridade na barra: limitador de pit > limitador de giro > troca > RPM.
+ * As bandeiras ocupam REVBAR_FLAG_LEDS LEDs em cada ponta da fita.
+ *
+ * Com o compositor a barra é desenhada na sua camada, e desativá-la deixa a
+ * camada transparente; o envio fica com o loop do compositor.
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef __REVBAR__H__
+#define __REVBAR__H__
+
+#include <Arduino.h>
+
+#include "constants/constants.h"
+#include "led/ILed.h"
+#include "led/LedCompositor.h"
+
+// Bits do byte de estado
+#define REVBAR_STATUS_LIMITER 0x01
+#define REVBAR_STATUS_PIT 0x02
+
+enum RevBarFlag
+{
+    REVBAR_FLAG_NONE = 0,
+    REVBAR_FLAG_GREEN,
+    REVBAR_FLAG_YELLOW,
+    REVBAR_FLAG_BLUE,
+    REVBAR_FLAG_RED,
+    REVBAR_FLAG_WHITE,
+    REVBAR_FLAG_CHECKERED,
+    REVBAR_FLAG_COUNT
+};
+
+/**
+ * @brief Telemetria de um frame (payload do comando stelm)
+ */
+struct RevBarTelemetry
+{
+    uint16_t rpm;   // Fração do RPM máximo (0-65535 = 0-100%)
+    uint16_t shift; // Ponto de troca na mesma escala (0 = sem indicação)
+    uint8_t status; // REVBAR_STATUS_*
+    uint8_t flag;   // RevBarFlag
+};
+
+#define REVBAR_TELEMETRY_SIZE 6
+
+class RevBar
+{
+private:
+    ILed *leds;
+    LedCompositor *compositor;
+    uint8_t layer;
+    uint16_t count;
+    RevBarTelemetry telemetry;
+    uint32_t lastTelemetry; // millis() da última telemetria
+    bool active;
+
+    void setPixel(uint16_t id, uint8_t r, uint8_t g, uint8_t b);
+    static bool phase(uint32_t now, uint16_t periodMs) { return (now / periodMs) & 1; }
+    void fillBar(uint16_t first, uint16_t end, uint8_t r, uint8_t g, uint8_t b);
+    void renderRpm(uint16_t first, uint16_t end);
+    void renderFlag(uint32_t now, uint16_t first, uint16_t end);
+public:
+    RevBar(ILed *leds);
+
+    /**
+     * @brief Desenha na camada do compositor em vez de direto na fita
+     * @param layer Camada já configurada cobrindo a fita
+     */
+    void setCompositor(LedCompositor *compositor, uint8_t layer);
+
+    /**
+     * @brief Decodifica o payload do comando stelm e ativa a renderização
+     * @param data REVBAR_TELEMETRY_SIZE bytes: RPM (2, big endian), troca (2), estado, bandeira
+     */
+    void setTelemetry(const uint8_t *data);
+
+    /**
+     * @brief Desativa a renderização sem apagar a fita (frames sleds assumem)
+     *
+     * Com o compositor a camada fica transparente, mostrando as de baixo.
+     */
+    void deactivate();
+
+    bool isActive() { return active; }
+
+    /**
+     * @brief Desenha o frame atual e solicita o envio
+     *
+     * Sem telemetria por REVBAR_TIMEOUT_MS a fita (ou a camada) é apagada e a barra desativada.
+     */
+    void loop();
+};
+
+#endif  //!__REVBAR__H__
@@ -0,0 +1,262 @@
+// Gerado por tools/animpack: 82 LEDs, 41 frames a 30 fps, 1 keyframes, formato spi (3 bits por símbolo)
+// Não editar: reempacotar a partir dos frames RGB
+
+#ifndef __LEDSIDLEANIMATION__H__
+#define __LEDSIDLEANIMATION__H__
+
+#include <stdint.h>
+
+alignas(4) static const uint8_t ledsIdleAnimation[3988] = {
+    0x4c, 0x41, 0x01, 0x00, 0x03, 0x03, 0x52, 0x00, 0x29, 0x00, 0x21, 0x00, 0x09, 0x00, 0x01, 0x00,
+    0xe4, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x4d, 0x24, 0x92, 0x49, 0x24, 0x9b,
+    0x6d, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x03, 0x00, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93, 0x69, 0xa6, 0x92, 0x6d, 0x36,
+    0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49, 0x24, 0x9b, 0x6d, 0x24, 0x00,
+    0x4d, 0x00, 0x05, 0x00, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92,
+    0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6, 0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d,
+    0xb4, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x05, 0x00, 0x92, 0x49, 0xa4, 0x92,
+    0x49, 0x24, 0x92, 0x4d, 0xa6, 0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69,
+    0x26, 0x92, 0x49, 0x24, 0x93, 0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36,
+    0x93, 0x4d, 0x24, 0x92, 0x49, 0x24, 0x9b, 0x6d, 0x24, 0x00, 0x00, 0x00, 0x4f, 0x00, 0x03, 0x00,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x00, 0x01, 0x00, 0x02, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x26,
+    0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6, 0x92,
+    0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93, 0x69,
+    0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49, 0x24,
+    0x9b, 0x6d, 0x24, 0x00, 0x51, 0x00, 0x01, 0x00, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x24, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x03, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x05, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x07, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x09, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x0d, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x0f, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x11, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x13, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x15, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x17, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x19, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x1b, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x1d, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x1f, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x21, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x23, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x25, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x27, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x29, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x2d, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x2f, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x31, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x33, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x35, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x37, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x39, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x3b, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x3d, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x3f, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x41, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x43, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x45, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x47, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24, 0x01, 0x00, 0x01, 0x00, 0x49, 0x00, 0x08, 0x00, 0x92, 0x49, 0x24, 0x92,
+    0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49, 0x24, 0x92, 0x49,
+    0x26, 0x92, 0x49, 0x24, 0x92, 0x49, 0x36, 0x92, 0x49, 0xa4, 0x92, 0x49, 0x24, 0x92, 0x4d, 0xa6,
+    0x92, 0x4d, 0x34, 0x92, 0x49, 0x24, 0x92, 0x6d, 0xb4, 0x92, 0x69, 0x26, 0x92, 0x49, 0x24, 0x93,
+    0x69, 0xa6, 0x92, 0x6d, 0x36, 0x92, 0x49, 0x24, 0x9a, 0x69, 0x36, 0x93, 0x4d, 0x24, 0x92, 0x49,
+    0x24, 0x9b, 0x6d, 0x24,
+};
+
+#endif  //!__LEDSIDLEANIMATION__H__
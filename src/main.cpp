@@ -1,5 +1,6 @@
 #include <Arduino.h>
 #include "comm/CommSimhub.h"
+#include "core/Scheduler.h"
 
 #if SDK_STM32DUINO
 #include "core/STM32Arduino.h"
@@ -9,23 +10,146 @@
 #include "core/Duino.h"
 #endif
 
-#define LEDS_COUNT 82
-
-ILed leds = ILed(LEDS_COUNT);
+StaticLed<LEDS_COUNT> leds;
 
 CommSimhub commSimhub(&leds, Core::getSerial(0), Core::getSerial(1), 0);
 
+#if LEDS_INTERPOLATION_ENABLED
+LedInterpolator interpolator(&leds, LEDS_INTERPOLATION_REFRESH_HZ);
+#endif
+
+#if REVBAR_ENABLED
+RevBar revBar(&leds);
+#endif
+
+#if LEDS_COMPOSITOR_ENABLED
+LedCompositor compositor(&leds);
+#endif
+
+#if LEDS_FRAME_CACHE_ENABLED
+EncodedFrameCache frameCache(&leds);
+#endif
+
+#if LEDS_SEGMENTS_ENABLED
+LedSegments segments(&leds);
+#endif
+
+#if LEDS_ANIMATION_ENABLED
+#include "led/animations/IdleAnimation.h"
+AnimationPlayer animation(&leds);
+#endif
+
+static void commTask() { commSimhub.loop(); }
+static void displayTask() { commSimhub.writeToComputer(); }
+static void showTask() { leds.update(); }
+static void coreTask() { Core::loop(); }
+#if LEDS_INTERPOLATION_ENABLED
+static void renderTask() { interpolator.loop(); }
+#endif
+#if REVBAR_ENABLED
+static void revBarTask() { revBar.loop(); }
+#endif
+#if LEDS_COMPOSITOR_ENABLED
+static void composeTask() { compositor.loop(); }
+#endif
+#if LEDS_ANIMATION_ENABLED
+static void animationTask() { animation.loop(); }
+#endif
+#if LEDS_SEGMENTS_ENABLED
+static void segmentsTask() { segments.loop(); }
+#endif
+
 void setup()
 {
     rcc_clk_enable(RCC_AFIO);
     afio_cfg_debug_ports(AFIO_DEBUG_SW_ONLY);
     afio_remap(AFIO_REMAP_SPI1); 
     
-    Core::begin();
+    // Fita primeiro: o frame de boot sai da flash antes da enumeração USB
+#if LEDS_BOOT_FRAME_ENABLED
+    leds.begin(WS2812BSolidFrame<LEDS_COUNT, LEDS_BOOT_COLOR_R, LEDS_BOOT_COLOR_G, LEDS_BOOT_COLOR_B>::data);
+#else
     leds.begin();
+#endif
+
+    Core::begin();
+    commSimhub.begin();
+
+#if LEDS_INTERPOLATION_ENABLED
+    if (interpolator.begin())
+    {
+        commSimhub.setInterpolator(&interpolator);
+    }
+#endif
+
+#if REVBAR_ENABLED
+    commSimhub.setRevBar(&revBar);
+#endif
+
+#if LEDS_COMPOSITOR_ENABLED
+    // Renderizadores locais em camadas próprias, acima dos frames do Simhub
+    compositor.setLayer(LEDS_COMPOSITOR_SIMHUB_LAYER, 0, leds.getCount());
+    commSimhub.setCompositor(&compositor);
+#if REVBAR_ENABLED
+    if (compositor.setLayer(LEDS_COMPOSITOR_REVBAR_LAYER, 0, leds.getCount()))
+    {
+        revBar.setCompositor(&compositor, LEDS_COMPOSITOR_REVBAR_LAYER);
+    }
+#endif
+#if LEDS_SEGMENTS_ENABLED
+    if (compositor.setLayer(LEDS_COMPOSITOR_SEGMENTS_LAYER, 0, leds.getCount()))
+    {
+        segments.setCompositor(&compositor, LEDS_COMPOSITOR_SEGMENTS_LAYER);
+    }
+#endif
+#if LEDS_ANIMATION_ENABLED
+    if (compositor.setLayer(LEDS_COMPOSITOR_ANIMATION_LAYER, 0, leds.getCount()))
+    {
+        animation.setCompositor(&compositor, LEDS_COMPOSITOR_ANIMATION_LAYER);
+    }
+#endif
+#endif
+
+#if LEDS_FRAME_CACHE_ENABLED
+    if (frameCache.begin())
+    {
+        commSimhub.setFrameCache(&frameCache);
+    }
+#endif
+
+#if LEDS_SEGMENTS_ENABLED
+    commSimhub.setSegments(&segments);
+#endif
+
+#if LEDS_ANIMATION_ENABLED
+    if (animation.begin(ledsIdleAnimation))
+    {
+        commSimhub.setAnimationPlayer(&animation);
+    }
+#endif
+
+    Scheduler::add("comm", commTask, TASK_COMM_PERIOD_US, TASK_COMM_BUDGET_US);
+    Scheduler::add("display", displayTask, TASK_DISPLAY_PERIOD_US, TASK_DISPLAY_BUDGET_US);
+#if LEDS_INTERPOLATION_ENABLED
+    Scheduler::add("render", renderTask, 1000000UL / LEDS_INTERPOLATION_REFRESH_HZ, 500);
+#endif
+#if REVBAR_ENABLED
+    Scheduler::add("revbar", revBarTask, 1000000UL / REVBAR_REFRESH_HZ, 500);
+#endif
+#if LEDS_COMPOSITOR_ENABLED
+    Scheduler::add("compose", composeTask, 1000000UL / LEDS_COMPOSITOR_REFRESH_HZ, 500);
+#endif
+#if LEDS_ANIMATION_ENABLED
+    Scheduler::add("animation", animationTask, 1000000UL / LEDS_ANIMATION_TASK_HZ, 200);
+#endif
+#if LEDS_SEGMENTS_ENABLED
+    Scheduler::add("segments", segmentsTask, 1000000UL / LEDS_SEGMENTS_TASK_HZ, 500);
+#endif
+    Scheduler::add("show", showTask, TASK_SHOW_PERIOD_US, TASK_SHOW_BUDGET_US);
+    Scheduler::add("core", coreTask, TASK_CORE_PERIOD_US, TASK_CORE_BUDGET_US);
 }
 
 void loop()
 {
-    commSimhub.loop();
+    Scheduler::loop();
 }
\ No newline at end of file
@@ -0,0 +1,295 @@
+/**
+ * @file animpack.cpp
+ * @brief Empacota uma sequência de frames RGB em uma animação pré-codificada para a flash
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * Lê frames RGB crus (leds * 3 bytes por frame, em sequência) e gera um
+ * header C com a imagem no formato de lib/LedAnimation: cada frame já
+ * codificado no stream do SPI (WS2812B) ou nos duty cycles do PWM
+ * (LedController), em GRB. O primeiro frame (e um a cada -k) é um keyframe
+ * completo, enviado por DMA direto da flash; os demais guardam só os trechos
+ * de LEDs que mudaram. Um delta maior que o keyframe vira keyframe.
+ *
+ * Uso: make animpack  (ou animpack [opções] <leds> <entrada.rgb|-> <saida.h>)
+ *   -f spi|pwm   formato de saída (padrão spi)
+ *   -b 3|4       bits por símbolo do SPI (padrão: o do WS2812B a 72MHz)
+ *   -r fps       frames por segundo (padrão 30)
+ *   -k n         keyframe a cada n frames (padrão 0 = só o primeiro)
+ *   -n nome      nome do array gerado (padrão ledAnimation)
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <string>
+#include <vector>
+
+#include <WS2812BEncoding.h>
+#include <LedPwmEncoding.h>
+#include <LedAnimation.h>
+
+#define ANIMPACK_COLOR_BYTES BYTES_PER_LED_RGB
+
+struct Options {
+    LedAnimationFormat format;
+    uint8_t symbolBits;
+    uint16_t fps;
+    uint16_t keyInterval;
+    std::string name;
+    uint16_t leds;
+    const char* input;
+    const char* output;
+};
+
+static void usage()
+{
+    fprintf(stderr, "uso: animpack [-f spi|pwm] [-b 3|4] [-r fps] [-k n] [-n nome] <leds> <entrada.rgb|-> <saida.h>\n");
+    exit(2);
+}
+
+// ==================== Codificação ====================
+
+/**
+ * @brief Codifica um LED (GRB) no formato da imagem
+ */
+static void encodeLed(const Options& opt, const uint8_t* rgb, uint8_t* dest)
+{
+    if (opt.format == LED_ANIMATION_SPI) {
+        if (opt.symbolBits == 4) {
+            WS2812B_encodePixelBits<4>(dest, rgb[0], rgb[1], rgb[2]);
+        } else {
+            WS2812B_encodePixelBits<3>(dest, rgb[0], rgb[1], rgb[2]);
+        }
+        return;
+    }
+
+    // PWM: 8 duty cycles por byte, gravados em little endian como o DMA os lê
+    const uint8_t grb[ANIMPACK_COLOR_BYTES] = { rgb[1], rgb[0], rgb[2] };
+    uint16_t slots[ANIMPACK_COLOR_BYTES * BITS_PER_BYTE];
+    for (uint8_t i = 0; i < ANIMPACK_COLOR_BYTES; i++) {
+        ledPwmEncodeByte(grb[i], slots + i * BITS_PER_BYTE);
+    }
+    for (size_t i = 0; i < sizeof(slots) / sizeof(slots[0]); i++) {
+        *dest++ = slots[i] & 0xFF;
+        *dest++ = slots[i] >> 8;
+    }
+}
+
+static uint16_t ledBytes(const Options& opt)
+{
+    if (opt.format == LED_ANIMATION_SPI) return 3 * opt.symbolBits;
+    return ANIMPACK_COLOR_BYTES * BITS_PER_BYTE * sizeof(uint16_t);
+}
+
+// ==================== Imagem ====================
+
+static void append(std::vector<uint8_t>& image, const void* data, size_t length)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    image.insert(image.end(), bytes, bytes + length);
+}
+
+static void pad(std::vector<uint8_t>& image)
+{
+    while (image.size() & 3) image.push_back(0);
+}
+
+static void appendKeyframe(std::vector<uint8_t>& image, const LedAnimationHeader& header, const Options& opt, const uint8_t* rgb)
+{
+    LedAnimationRecord record = { LED_ANIMATION_KEY, 0, 0 };
+    append(image, &record, sizeof(record));
+
+    // SPI: preâmbulo + LEDs + cleardown; PWM: LEDs + zeros do reset
+    size_t start = image.size();
+    image.resize(start + header.keyBytes, 0);
+    uint8_t* dest = &image[start + header.keyOffset];
+    for (uint16_t i = 0; i < opt.leds; i++) {
+        encodeLed(opt, rgb + i * 3, dest + i * header.ledBytes);
+    }
+    pad(image);
+}
+
+/**
+ * @brief Trechos de LEDs que mudaram, como pares [primeiro, fim)
+ */
+static std::vector<std::pair<uint16_t, uint16_t> > changedRuns(const Options& opt, const uint8_t* prev, const uint8_t* rgb)
+{
+    std::vector<std::pair<uint16_t, uint16_t> > runs;
+    uint16_t i = 0;
+    while (i < opt.leds) {
+        if (memcmp(prev + i * 3, rgb + i * 3, 3) == 0) {
+            i++;
+            continue;
+        }
+        // Um trecho novo custa 4 bytes de cabeçalho, menos que qualquer LED igual no meio
+        uint16_t first = i;
+        while (i < opt.leds && memcmp(prev + i * 3, rgb + i * 3, 3) != 0) i++;
+        runs.push_back(std::make_pair(first, i));
+    }
+    return runs;
+}
+
+static size_t deltaBytes(const LedAnimationHeader& header, const std::vector<std::pair<uint16_t, uint16_t> >& runs)
+{
+    size_t bytes = sizeof(LedAnimationRecord);
+    for (size_t r = 0; r < runs.size(); r++) {
+        bytes += sizeof(LedAnimationRun) + LED_ANIMATION_ALIGN((uint32_t)(runs[r].second - runs[r].first) * header.ledBytes);
+    }
+    return bytes;
+}
+
+static void appendDelta(std::vector<uint8_t>& image, const LedAnimationHeader& header, const Options& opt,
+                        const uint8_t* rgb, const std::vector<std::pair<uint16_t, uint16_t> >& runs)
+{
+    LedAnimationRecord record = { LED_ANIMATION_DELTA, 0, (uint16_t)runs.size() };
+    append(image, &record, sizeof(record));
+
+    for (size_t r = 0; r < runs.size(); r++) {
+        LedAnimationRun run = { runs[r].first, (uint16_t)(runs[r].second - runs[r].first) };
+        append(image, &run, sizeof(run));
+        size_t start = image.size();
+        image.resize(start + run.count * header.ledBytes);
+        for (uint16_t i = 0; i < run.count; i++) {
+            encodeLed(opt, rgb + (run.first + i) * 3, &image[start + i * header.ledBytes]);
+        }
+        pad(image);
+    }
+}
+
+// ==================== Entrada e saída ====================
+
+static bool readInput(const char* path, std::vector<uint8_t>& data)
+{
+    FILE* f = strcmp(path, "-") == 0 ? stdin : fopen(path, "rb");
+    if (f == NULL) return false;
+    uint8_t buffer[4096];
+    size_t n;
+    while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) {
+        data.insert(data.end(), buffer, buffer + n);
+    }
+    if (f != stdin) fclose(f);
+    return true;
+}
+
+static bool writeHeader(const char* path, const Options& opt, const std::vector<uint8_t>& image,
+                        uint16_t frames, uint16_t keyframes)
+{
+    FILE* f = fopen(path, "w");
+    if (f == NULL) return false;
+
+    std::string guard = "__";
+    for (size_t i = 0; i < opt.name.size(); i++) guard += (char)toupper((unsigned char)opt.name[i]);
+    guard += "__H__";
+
+    fprintf(f, "// Gerado por tools/animpack: %u LEDs, %u frames a %u fps, %u keyframes, formato %s",
+            opt.leds, frames, opt.fps, keyframes, opt.format == LED_ANIMATION_SPI ? "spi" : "pwm");
+    if (opt.format == LED_ANIMATION_SPI) fprintf(f, " (%u bits por símbolo)", opt.symbolBits);
+    fprintf(f, "\n// Não editar: reempacotar a partir dos frames RGB\n\n");
+    fprintf(f, "#ifndef %s\n#define %s\n\n#include <stdint.h>\n\n", guard.c_str(), guard.c_str());
+    fprintf(f, "alignas(4) static const uint8_t %s[%u] = {", opt.name.c_str(), (unsigned)image.size());
+    for (size_t i = 0; i < image.size(); i++) {
+        fprintf(f, "%s0x%02x,", i % 16 ? " " : "\n    ", image[i]);
+    }
+    fprintf(f, "\n};\n\n#endif  //!%s\n", guard.c_str());
+
+    return fclose(f) == 0;
+}
+
+int main(int argc, char** argv)
+{
+    Options opt;
+    opt.format = LED_ANIMATION_SPI;
+    opt.symbolBits = WS2812B_SYMBOL_BITS;
+    opt.fps = 30;
+    opt.keyInterval = 0;
+    opt.name = "ledAnimation";
+
+    int arg = 1;
+    for (; arg < argc && argv[arg][0] == '-' && argv[arg][1] != '\0'; arg += 2) {
+        if (arg + 1 >= argc) usage();
+        const char* value = argv[arg + 1];
+        switch (argv[arg][1]) {
+        case 'f':
+            if (strcmp(value, "spi") == 0) opt.format = LED_ANIMATION_SPI;
+            else if (strcmp(value, "pwm") == 0) opt.format = LED_ANIMATION_PWM;
+            else usage();
+            break;
+        case 'b': opt.symbolBits = atoi(value); break;
+        case 'r': opt.fps = atoi(value); break;
+        case 'k': opt.keyInterval = atoi(value); break;
+        case 'n': opt.name = value; break;
+        default: usage();
+        }
+    }
+    if (argc - arg != 3) usage();
+    opt.leds = atoi(argv[arg]);
+    opt.input = argv[arg + 1];
+    opt.output = argv[arg + 2];
+    if (opt.leds == 0 || opt.fps == 0 || opt.fps > 1000 || (opt.symbolBits != 3 && opt.symbolBits != 4)) usage();
+
+    std::vector<uint8_t> rgb;
+    if (!readInput(opt.input, rgb)) {
+        fprintf(stderr, "animpack: não foi possível ler %s\n", opt.input);
+        return 1;
+    }
+    size_t frameSize = (size_t)opt.leds * 3;
+    if (rgb.empty() || rgb.size() % frameSize != 0 || rgb.size() / frameSize > 0xFFFF) {
+        fprintf(stderr, "animpack: %s não tem um número inteiro de frames de %u LEDs\n", opt.input, opt.leds);
+        return 1;
+    }
+    uint16_t frames = rgb.size() / frameSize;
+
+    LedAnimationHeader header;
+    memset(&header, 0, sizeof(header));
+    header.magic[0] = 'L';
+    header.magic[1] = 'A';
+    header.version = LED_ANIMATION_VERSION;
+    header.format = opt.format;
+    header.symbolBits = opt.format == LED_ANIMATION_SPI ? opt.symbolBits : 0;
+    header.colorBytes = ANIMPACK_COLOR_BYTES;
+    header.leds = opt.leds;
+    header.frames = frames;
+    header.frameMs = (1000 + opt.fps / 2) / opt.fps;
+    header.ledBytes = ledBytes(opt);
+    if (opt.format == LED_ANIMATION_SPI) {
+        header.keyOffset = 1;
+        header.keyBytes = (uint32_t)opt.leds * header.ledBytes + 2;
+    } else {
+        header.keyOffset = 0;
+        header.keyBytes = (uint32_t)opt.leds * header.ledBytes + WS2812_RESET_CYCLES * sizeof(uint16_t);
+    }
+
+    std::vector<uint8_t> image;
+    append(image, &header, sizeof(header));
+
+    uint16_t keyframes = 0;
+    size_t keySize = sizeof(LedAnimationRecord) + LED_ANIMATION_ALIGN(header.keyBytes);
+    for (uint16_t f = 0; f < frames; f++) {
+        const uint8_t* frame = &rgb[f * frameSize];
+        bool key = f == 0 || (opt.keyInterval && f % opt.keyInterval == 0);
+        std::vector<std::pair<uint16_t, uint16_t> > runs;
+        if (!key) {
+            runs = changedRuns(opt, frame - frameSize, frame);
+            key = deltaBytes(header, runs) >= keySize;
+        }
+        if (key) {
+            appendKeyframe(image, header, opt, frame);
+            keyframes++;
+        } else {
+            appendDelta(image, header, opt, frame, runs);
+        }
+    }
+
+    if (!writeHeader(opt.output, opt, image, frames, keyframes)) {
+        fprintf(stderr, "animpack: não foi possível gravar %s\n", opt.output);
+        return 1;
+    }
+    printf("%s: %u frames, %u keyframes, %u bytes (%u bytes só com keyframes)\n", opt.output, frames, keyframes,
+           (unsigned)image.size(), (unsigned)(sizeof(header) + frames * keySize));
+    return 0;
+}
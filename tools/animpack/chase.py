@@ -0,0 +1,31 @@
+# Gera os frames RGB crus da animação de espera (um cometa azul percorrendo a fita)
+#
+# Uso: python3 chase.py <leds> > frames.rgb   (ver o alvo idle-animation do Makefile)
+#
+# O cometa anda STEP LEDs por frame e dá a volta na fita; só a cabeça e a
+# cauda mudam entre frames, então os deltas ficam pequenos.
+
+import sys
+
+TAIL = 6
+STEP = 2
+COLOR = (0, 40, 120)
+
+
+def frame(leds, head):
+    pixels = bytearray(leds * 3)
+    for t in range(TAIL):
+        level = (TAIL - t) / TAIL
+        i = (head - t) % leds
+        pixels[i * 3:i * 3 + 3] = bytes(int(c * level * level) for c in COLOR)
+    return pixels
+
+
+def main():
+    leds = int(sys.argv[1])
+    out = sys.stdout.buffer
+    for head in range(0, leds, STEP):
+        out.write(frame(leds, head))
+
+
+main()
@@ -0,0 +1,414 @@
+/**
+ * @file encoder_bench.cpp
+ * @brief Benchmark no host dos codificadores de LED
+ * @version 1.0
+ * @date 2026-10-18
+ * 
+ * Roda cada codificador sobre fitas de 10 a 2000 LEDs com frames aleatórios,
+ * sólidos e esparsos (~2% dos LEDs mudam por frame) e reporta ns/pixel,
+ * ciclos/pixel (x86) e bytes de memória de trabalho. Os resultados também
+ * são gravados em JSON para comparar versões.
+ * 
+ * LedController, WS2812B e WS2812_BitBang são compilados das bibliotecas,
+ * sobre o shim do core em tools/bench/shim (relógio, SPI e DMA simulados).
+ * O WS2812B entra duas vezes, com buffer duplo e com buffer único
+ * (ws2812b_variant.h), e também tem a latência medida com o SPI no tempo do
+ * fio: da escrita de um frame até ele travar nos LEDs.
+ * 
+ * Uso: make bench  (ou encoder_bench [saida.json])
+ * 
+ * @copyright Copyright (c) 2026
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_HAS_TSC 1
+#else
+#define BENCH_HAS_TSC 0
+#endif
+
+#include <WS2812BEncoding.h>
+#include <LedController.h>
+#include <LedColor.h>
+#include <WS2812BitBang.h>
+
+#include "shim/BenchHost.h"
+#include "ws2812b_variant.h"
+#include "led/ILed.h"
+#include "led/EncodedFrameCache.h"
+#include "comm/FrameHash.h"
+
+#ifndef BENCH_REVISION
+#define BENCH_REVISION "unknown"
+#endif
+
+#define BENCH_FRAMES        16      // Frames pré-gerados por tipo
+#define BENCH_MIN_NS        20000000ULL
+#define BENCH_SPARSE_PCT    2
+#define BENCH_LATCH_US      300     // Reset do WS2812B após o envio
+#define BENCH_LATENCY_FRAMES 32
+
+static const uint16_t ledCounts[] = { 10, 50, 100, 250, 500, 1000, 2000 };
+static const uint16_t latencyCounts[] = { 50, 250, 1000 };
+
+enum FrameKind { FRAME_RANDOM = 0, FRAME_SOLID, FRAME_SPARSE };
+static const char* frameNames[] = { "random", "solid", "sparse" };
+
+// ==================== Codificadores ====================
+
+/**
+ * @brief Estado de um codificador para uma fita de n LEDs
+ */
+struct Encoder {
+    const char* name;
+    size_t (*workingBytes)(uint16_t n);
+    void (*setup)(uint16_t n);
+    void (*encode)(const uint8_t* rgb, uint16_t n);
+    const char* (*note)();   // Informação extra da execução (opcional)
+};
+
+static std::vector<uint8_t> bytes8;
+static std::vector<uint16_t> bytes16;
+static std::vector<Color> colors;
+static volatile uint32_t sink;
+
+// WS2812B: LUT SPI gerada em tempo de compilação, Bits bits SPI por bit de dado, direto no
+// buffer duplo, mais a cópia do show(). 3 bits é a codificação de 72MHz; 4 bits a de 64MHz
+template<uint8_t Bits>
+static size_t spiLutBytes(uint16_t n) { return ((size_t)n * 3 * Bits + 2) * 2 + sizeof(WS2812BLut<Bits>::data); }
+template<uint8_t Bits>
+static void spiLutSetup(uint16_t n) { bytes8.assign(((size_t)n * 3 * Bits + 2) * 2, 0); }
+template<uint8_t Bits>
+static void spiLutEncode(const uint8_t* rgb, uint16_t n)
+{
+    size_t numBytes = bytes8.size() / 2;
+    uint8_t* pixels = bytes8.data();
+    for (uint16_t i = 0; i < n; i++, rgb += 3) {
+        WS2812B_encodePixelBits<Bits>(pixels + i * 3 * Bits + 1, rgb[0], rgb[1], rgb[2]);
+    }
+    memcpy(pixels + numBytes, pixels, numBytes);
+}
+
+// WS2812B real com buffer duplo e com buffer único (WS2812B_SINGLE_BUFFER): setPixelColor() de
+// todos os LEDs + show(). Aqui o SPI do shim termina na hora, então é só o custo de CPU; com o
+// DMA andando, ver measureLatency()
+static void doubleEncode(const uint8_t* rgb, uint16_t n) { ws2812bDouble::write(rgb, n); ws2812bDouble::show(); }
+static void singleEncode(const uint8_t* rgb, uint16_t n) { ws2812bSingle::write(rgb, n); ws2812bSingle::show(); }
+
+// WS2812B com o cache de frames codificados do firmware (EncodedFrameCache), como em
+// CommSimhub::applyLedsFrame(): hash do payload, load() e, na falha, setPixelColor() de todos os
+// LEDs e store(); depois show(). O pool tem LEDS_FRAME_CACHE_BYTES, então os BENCH_FRAMES frames
+// só cabem em fitas curtas e nas demais o LRU erra sempre (posições e acertos na nota)
+static ILed* cacheLeds = nullptr;
+static EncodedFrameCache* cache = nullptr;
+static size_t cacheBytes(uint16_t n) { return WS2812B_BUFFER_SIZE(n) + sizeof(encoderLookup) + sizeof(EncodedFrameCache); }
+static void cacheSetup(uint16_t n)
+{
+    delete cache;
+    delete cacheLeds;
+    cacheLeds = new ILed(n);
+    cacheLeds->begin();
+    cacheLeds->setFullRefreshInterval(0);
+    cache = new EncodedFrameCache(cacheLeds);
+    cache->begin();
+}
+static void cacheEncode(const uint8_t* rgb, uint16_t n)
+{
+    uint32_t hash = frameHash(rgb, n * 3);
+    if (!cache->load(hash, n, 0)) {
+        for (uint16_t i = 0; i < n; i++) {
+            cacheLeds->setPixelColor(i, rgb[i * 3], rgb[i * 3 + 1], rgb[i * 3 + 2]);
+        }
+        cache->store(hash, n, 0);
+    }
+    cacheLeds->show();
+}
+static const char* cacheNote()
+{
+    static char note[48];
+    snprintf(note, sizeof(note), "slots=%u hits=%.1f%%", cache->getSlots(), cache->getHitRate());
+    return note;
+}
+
+// LedController: setPixelColor no buffer GRB + show(), que codifica a fita inteira em PWM de 16 bits
+// por bit no buffer DMA. Com os buffers do chamador não há bitmap de LEDs alterados, então todo
+// show() recodifica todos os LEDs. O DMA do shim termina na hora; o reset de 300us é pulado no relógio
+static LedController* pwm = nullptr;
+static size_t pwmBytes(uint16_t n)
+{
+    return LED_CONTROLLER_PIXEL_BUFFER_SIZE(n, BYTES_PER_LED_RGB)
+         + LED_CONTROLLER_DMA_BUFFER_SIZE(n, BYTES_PER_LED_RGB) * sizeof(uint16_t);
+}
+static void pwmSetup(uint16_t n)
+{
+    bytes8.assign(LED_CONTROLLER_PIXEL_BUFFER_SIZE(n, BYTES_PER_LED_RGB), 0);
+    bytes16.assign(LED_CONTROLLER_DMA_BUFFER_SIZE(n, BYTES_PER_LED_RGB), 0);
+    LedConfig config;
+    config.numLeds = n;
+    delete pwm;
+    pwm = new LedController(config, bytes8.data(), bytes16.data());
+    pwm->begin();
+    pwm->setFullRefreshInterval(0);
+}
+static void pwmShow(LedController* controller, const uint8_t* rgb, uint16_t n)
+{
+    for (uint16_t i = 0; i < n; i++, rgb += 3) {
+        controller->setPixelColor(i, rgb[0], rgb[1], rgb[2]);
+    }
+    while (!controller->canShow()) benchSkipUs(100);
+    controller->show();
+}
+static void pwmEncode(const uint8_t* rgb, uint16_t n) { pwmShow(pwm, rgb, n); }
+
+// LedController incremental (buffers alocados em begin()): bitmap de LEDs alterados, só eles são
+// recodificados no buffer DMA
+static LedController* pwmDirty = nullptr;
+static size_t pwmDirtyBytes(uint16_t n) { return pwmBytes(n) + LED_CONTROLLER_DIRTY_WORDS(n) * sizeof(uint32_t); }
+static void pwmDirtySetup(uint16_t n)
+{
+    delete pwmDirty;
+    pwmDirty = new LedController(n);
+    pwmDirty->begin();
+    pwmDirty->setFullRefreshInterval(0);
+}
+static void pwmDirtyEncode(const uint8_t* rgb, uint16_t n) { pwmShow(pwmDirty, rgb, n); }
+
+// WS2812_BitBang: setPixelColor no buffer GRB cru. A codificação é feita no envio, por tempo, e
+// show() não faz nada no host
+static WS2812_BitBang* bitBang = nullptr;
+static size_t bitBangBytes(uint16_t n) { return WS2812_BITBANG_BUFFER_SIZE(n); }
+static void bitBangSetup(uint16_t n)
+{
+    bytes8.assign(WS2812_BITBANG_BUFFER_SIZE(n), 0);
+    delete bitBang;
+    bitBang = new WS2812_BitBang(n, PA0, bytes8.data());
+    bitBang->begin();
+}
+static void bitBangEncode(const uint8_t* rgb, uint16_t n)
+{
+    for (uint16_t i = 0; i < n; i++, rgb += 3) {
+        bitBang->setPixelColor(i, rgb[0], rgb[1], rgb[2]);
+    }
+    bitBang->show();
+}
+
+// LedColor::hsvSpan: geração do rainbow (o frame de entrada é ignorado)
+static size_t hsvBytes(uint16_t n) { return n * sizeof(Color); }
+static void hsvSetup(uint16_t n) { colors.assign(n, 0); }
+static void hsvEncode(const uint8_t* rgb, uint16_t n)
+{
+    LedColor::hsvSpan(colors.data(), n, rgb[0], 256, n, 255, 255);
+}
+
+static const Encoder encoders[] = {
+    { "ws2812b_spi_lut",     spiLutBytes<3>, spiLutSetup<3>, spiLutEncode<3> },
+    { "ws2812b_spi_lut4",    spiLutBytes<4>, spiLutSetup<4>, spiLutEncode<4> },
+    { "ws2812b_double",      ws2812bDouble::bytes, ws2812bDouble::setup, doubleEncode },
+    { "ws2812b_single",      ws2812bSingle::bytes, ws2812bSingle::setup, singleEncode },
+    { "ws2812b_frame_cache", cacheBytes,     cacheSetup,     cacheEncode, cacheNote },
+    { "ledcontroller_pwm",   pwmBytes,       pwmSetup,       pwmEncode },
+    { "ledcontroller_dirty", pwmDirtyBytes,  pwmDirtySetup,  pwmDirtyEncode },
+    { "bitbang_grb",         bitBangBytes,   bitBangSetup,   bitBangEncode },
+    { "ledcolor_hsv_span",   hsvBytes,       hsvSetup,       hsvEncode },
+};
+
+// ==================== Frames ====================
+
+static void makeFrames(std::vector<uint8_t>& frames, FrameKind kind, uint16_t n)
+{
+    size_t frameBytes = (size_t)n * 3;
+    frames.assign(frameBytes * BENCH_FRAMES, 0);
+    
+    for (int f = 0; f < BENCH_FRAMES; f++) {
+        uint8_t* frame = &frames[f * frameBytes];
+        switch (kind) {
+            case FRAME_RANDOM:
+                for (size_t i = 0; i < frameBytes; i++) frame[i] = rand();
+                break;
+            case FRAME_SOLID: {
+                uint8_t r = rand(), g = rand(), b = rand();
+                for (uint16_t i = 0; i < n; i++) {
+                    frame[i * 3] = r; frame[i * 3 + 1] = g; frame[i * 3 + 2] = b;
+                }
+                break;
+            }
+            case FRAME_SPARSE:
+                if (f == 0) {
+                    for (size_t i = 0; i < frameBytes; i++) frame[i] = rand();
+                } else {
+                    memcpy(frame, frame - frameBytes, frameBytes);
+                    uint16_t changes = n * BENCH_SPARSE_PCT / 100 + 1;
+                    for (uint16_t c = 0; c < changes; c++) {
+                        uint16_t i = rand() % n;
+                        frame[i * 3] = rand(); frame[i * 3 + 1] = rand(); frame[i * 3 + 2] = rand();
+                    }
+                }
+                break;
+        }
+    }
+}
+
+// ==================== Medição ====================
+
+static uint64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static uint64_t nowCycles()
+{
+#if BENCH_HAS_TSC
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+// ==================== Latência ====================
+
+struct Variant {
+    const char* name;
+    void (*setup)(uint16_t n);
+    void (*write)(const uint8_t* rgb, uint16_t n);
+    void (*show)();
+};
+
+static const Variant variants[] = {
+    { "ws2812b_double", ws2812bDouble::setup, ws2812bDouble::write, ws2812bDouble::show },
+    { "ws2812b_single", ws2812bSingle::setup, ws2812bSingle::write, ws2812bSingle::show },
+};
+
+static void skipUntil(uint64_t ns)
+{
+    uint64_t now = benchNowNs();
+    if (ns > now) benchSkipUs((ns - now + 999) / 1000);
+}
+
+/**
+ * @brief Latência da escrita até o frame travar nos LEDs, com o SPI no tempo do fio
+ *
+ * Frames aleatórios escritos um atrás do outro: cada um logo após o show() do
+ * anterior, com o DMA ainda enviando. Com buffer único cada pixel espera o DMA
+ * passar por ele; com buffer duplo a escrita vai para a outra metade. O show()
+ * ocorre assim que o frame anterior trava (fim do envio + BENCH_LATCH_US), e
+ * essas esperas são puladas no relógio. Reporta a média por frame do tempo de
+ * CPU preso nas escritas e da latência.
+ */
+static void measureLatency(FILE* json)
+{
+    std::vector<uint8_t> frames;
+    benchSetSpiByteNs(8 * WS2812B_BIT_NS);
+
+    printf("\n%-20s %6s %10s %12s %10s\n", "latency", "leds", "write_us", "latency_us", "wire_us");
+    fprintf(json, "\n  ],\n  \"latency\": [");
+
+    bool first = true;
+    for (size_t c = 0; c < sizeof(latencyCounts) / sizeof(latencyCounts[0]); c++) {
+        uint16_t n = latencyCounts[c];
+        makeFrames(frames, FRAME_RANDOM, n);
+        double wireUs = ((double)n * WS2812B_BYTES_PER_PIXEL + 2) * 8 * WS2812B_BIT_NS / 1000;
+
+        for (size_t v = 0; v < sizeof(variants) / sizeof(variants[0]); v++) {
+            const Variant& var = variants[v];
+            var.setup(n);
+            var.write(&frames[0], n);
+            var.show();
+
+            uint64_t writeNs = 0, latencyNs = 0;
+            for (int f = 1; f <= BENCH_LATENCY_FRAMES; f++) {
+                uint64_t start = benchNowNs();
+                var.write(&frames[(f % BENCH_FRAMES) * n * 3], n);
+                writeNs += benchNowNs() - start;
+
+                skipUntil(benchSpiEndNs() + BENCH_LATCH_US * 1000ULL);
+                var.show();
+                latencyNs += benchSpiEndNs() + BENCH_LATCH_US * 1000ULL - start;
+            }
+
+            double writeUs = writeNs / 1000.0 / BENCH_LATENCY_FRAMES;
+            double latencyUs = latencyNs / 1000.0 / BENCH_LATENCY_FRAMES;
+            printf("%-20s %6u %10.1f %12.1f %10.1f\n", var.name, n, writeUs, latencyUs, wireUs);
+            fprintf(json, "%s\n    {\"encoder\": \"%s\", \"leds\": %u, \"write_us\": %.1f, "
+                    "\"latency_us\": %.1f, \"wire_us\": %.1f}",
+                    first ? "" : ",", var.name, n, writeUs, latencyUs, wireUs);
+            first = false;
+        }
+    }
+
+    benchSetSpiByteNs(0);
+}
+
+int main(int argc, char** argv)
+{
+    const char* jsonPath = argc > 1 ? argv[1] : "encoder_bench.json";
+    FILE* json = fopen(jsonPath, "w");
+    if (!json) {
+        fprintf(stderr, "cannot open %s\n", jsonPath);
+        return 1;
+    }
+    
+    srand(1234);
+    std::vector<uint8_t> frames;
+    
+    fprintf(json, "{\n  \"version\": 1,\n  \"revision\": \"%s\",\n  \"results\": [", BENCH_REVISION);
+    printf("%-20s %6s %-7s %10s %12s %12s\n", "encoder", "leds", "frame", "ns/pixel", "cycles/pixel", "bytes");
+    
+    bool first = true;
+    for (size_t e = 0; e < sizeof(encoders) / sizeof(encoders[0]); e++) {
+        const Encoder& enc = encoders[e];
+        
+        for (size_t c = 0; c < sizeof(ledCounts) / sizeof(ledCounts[0]); c++) {
+            uint16_t n = ledCounts[c];
+            
+            for (int k = FRAME_RANDOM; k <= FRAME_SPARSE; k++) {
+                makeFrames(frames, (FrameKind)k, n);
+                enc.setup(n);
+                
+                // Aquecimento
+                for (int f = 0; f < BENCH_FRAMES; f++) enc.encode(&frames[f * n * 3], n);
+                
+                uint64_t iterations = 0;
+                uint64_t startNs = nowNs();
+                uint64_t startCycles = nowCycles();
+                uint64_t elapsed;
+                do {
+                    for (int f = 0; f < BENCH_FRAMES; f++) enc.encode(&frames[f * n * 3], n);
+                    iterations += BENCH_FRAMES;
+                    elapsed = nowNs() - startNs;
+                } while (elapsed < BENCH_MIN_NS);
+                uint64_t cycles = nowCycles() - startCycles;
+                
+                sink = bytes8.empty() ? 0 : bytes8[0];
+                
+                double pixels = (double)iterations * n;
+                double nsPerPixel = elapsed / pixels;
+                double cyclesPerPixel = cycles / pixels;
+                size_t workingBytes = enc.workingBytes(n);
+                
+                const char* note = enc.note ? enc.note() : "";
+                
+                printf("%-20s %6u %-7s %10.2f %12.2f %12zu  %s\n", enc.name, n, frameNames[k],
+                       nsPerPixel, cyclesPerPixel, workingBytes, note);
+                fprintf(json, "%s\n    {\"encoder\": \"%s\", \"leds\": %u, \"frame\": \"%s\", "
+                        "\"ns_per_pixel\": %.3f, \"cycles_per_pixel\": %.3f, \"working_bytes\": %zu, \"note\": \"%s\"}",
+                        first ? "" : ",", enc.name, n, frameNames[k], nsPerPixel, cyclesPerPixel, workingBytes, note);
+                first = false;
+            }
+        }
+    }
+    
+    measureLatency(json);
+
+    fprintf(json, "\n  ]\n}\n");
+    fclose(json);
+    printf("results written to %s\n", jsonPath);
+    return 0;
+}
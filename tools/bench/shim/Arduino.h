@@ -0,0 +1,48 @@
+/**
+ * @file Arduino.h
+ * @brief Shim do core Arduino/libmaple para compilar as bibliotecas de LED no host (make bench)
+ * @version 1.0
+ * @date 2026-10-18
+ * 
+ * Só o que LedController, WS2812B e WS2812_BitBang usam. O relógio e o DMA
+ * são simulados em BenchHost.cpp (ver BenchHost.h).
+ * 
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef __BENCH_ARDUINO_H__
+#define __BENCH_ARDUINO_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Mesmo clock da blue pill, para a codificação SPI de 72MHz
+#ifndef F_CPU
+#define F_CPU 72000000L
+#endif
+
+typedef bool boolean;
+
+#define LOW     0
+#define HIGH    1
+#define INPUT   0
+#define OUTPUT  1
+
+enum {
+    PA0 = 0, PA1, PA2, PA3, PA4, PA5, PA6, PA7, PA8, PA9, PA10, PA11, PA12, PA13, PA14, PA15,
+    PB0, PB1, PB2, PB3, PB4, PB5, PB6, PB7, PB8, PB9, PB10, PB11, PB12, PB13, PB14, PB15
+};
+
+uint32_t millis();
+uint32_t micros();
+void delayMicroseconds(uint32_t us);
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+
+void noInterrupts();
+void interrupts();
+
+#endif
@@ -0,0 +1,99 @@
+/**
+ * @file BenchHost.cpp
+ * @brief Implementação do shim do core para o host (make bench)
+ * @version 1.0
+ * @date 2026-10-18
+ * 
+ * @copyright Copyright (c) 2026
+ */
+
+#include <chrono>
+
+#include "Arduino.h"
+#include "BenchHost.h"
+#include "SPI.h"
+#include "libmaple/dma.h"
+#include "libmaple/gpio.h"
+#include "libmaple/timer.h"
+
+// ==================== Relógio ====================
+
+static uint64_t skippedNs = 0;
+
+uint64_t benchNowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count() + skippedNs;
+}
+
+void benchSkipUs(uint32_t us)
+{
+    skippedNs += (uint64_t)us * 1000;
+}
+
+uint32_t micros() { return (uint32_t)(benchNowNs() / 1000); }
+uint32_t millis() { return (uint32_t)(benchNowNs() / 1000000); }
+
+void delayMicroseconds(uint32_t us)
+{
+    uint64_t end = benchNowNs() + (uint64_t)us * 1000;
+    while (benchNowNs() < end) { }
+}
+
+// ==================== GPIO e interrupções ====================
+
+void pinMode(uint8_t, uint8_t) {}
+void digitalWrite(uint8_t, uint8_t) {}
+void noInterrupts() {}
+void interrupts() {}
+
+static gpio_reg_map gpioRegs[2];
+static gpio_dev gpioA = { &gpioRegs[0] }, gpioB = { &gpioRegs[1] };
+gpio_dev *GPIOA = &gpioA, *GPIOB = &gpioB;
+
+// ==================== Timers ====================
+
+static timer_reg_map timerRegs[4];
+static timer_dev timers[4] = { {{ &timerRegs[0] }}, {{ &timerRegs[1] }}, {{ &timerRegs[2] }}, {{ &timerRegs[3] }} };
+timer_dev *TIMER1 = &timers[0], *TIMER2 = &timers[1], *TIMER3 = &timers[2], *TIMER4 = &timers[3];
+
+// ==================== DMA ====================
+
+static dma_dev dma1;
+dma_dev* DMA1 = &dma1;
+static dma_tube_reg_map tubes[7];
+
+void dma_init(dma_dev*) {}
+void dma_disable(dma_dev*, dma_channel channel) { tubes[channel - 1].CCR = 0; }
+dma_tube_reg_map* dma_tube_regs(dma_dev*, dma_channel channel) { return &tubes[channel - 1]; }
+void dma_clear_isr_bits(dma_dev*, dma_channel) {}
+uint8_t dma_get_isr_bits(dma_dev*, dma_channel) { return DMA_ISR_TCIF; }
+
+// ==================== SPI ====================
+
+static uint32_t spiByteNs = 0;
+static uint64_t spiStartNs = 0, spiEndNs = 0;
+static uint16_t spiBytes = 0;
+
+SPIClass SPI;
+
+void benchSetSpiByteNs(uint32_t ns) { spiByteNs = ns; }
+uint64_t benchSpiStartNs() { return spiStartNs; }
+uint64_t benchSpiEndNs() { return spiEndNs; }
+
+uint8_t SPIClass::dmaSendAsync(const void*, uint16_t length, bool)
+{
+    while (benchNowNs() < spiEndNs) { }
+    spiStartNs = benchNowNs();
+    spiEndNs = spiStartNs + (uint64_t)length * spiByteNs;
+    spiBytes = length;
+    return 1;
+}
+
+// Único canal de envio simulado: o do SPI
+uint16_t dma_get_count(dma_dev*, dma_channel)
+{
+    uint64_t now = benchNowNs();
+    if (spiByteNs == 0 || now >= spiEndNs) return 0;
+    return spiBytes - (uint16_t)((now - spiStartNs) / spiByteNs);
+}
@@ -0,0 +1,46 @@
+/**
+ * @file BenchHost.h
+ * @brief Relógio simulado do host para as bibliotecas de LED (make bench)
+ * @version 1.0
+ * @date 2026-10-18
+ * 
+ * micros() e millis() seguem o relógio real mais um deslocamento que o
+ * benchmark pode avançar sem esperar, por exemplo para pular o reset de
+ * 300us entre dois show() do LedController sem medir a espera.
+ * 
+ * O SPI do WS2812B é simulado por tempo: um envio lê um byte a cada
+ * benchSetSpiByteNs() ns desse relógio, e dma_get_count() devolve os bytes
+ * que ainda faltam. Com 0 (o padrão) todo envio termina na hora.
+ * 
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef __BENCH_HOST_H__
+#define __BENCH_HOST_H__
+
+#include <stdint.h>
+
+/**
+ * @brief Tempo do host em ns (relógio real + avanços de benchSkipUs)
+ */
+uint64_t benchNowNs();
+
+/**
+ * @brief Avança micros()/millis() sem esperar
+ */
+void benchSkipUs(uint32_t us);
+
+/**
+ * @brief Tempo de um byte no SPI simulado, em ns (0 = envios terminam na hora)
+ *
+ * Com tempo, SPI.dmaSendAsync() espera o envio anterior terminar, como no libmaple.
+ */
+void benchSetSpiByteNs(uint32_t ns);
+
+/**
+ * @brief Início e fim (em benchNowNs()) do último envio SPI
+ */
+uint64_t benchSpiStartNs();
+uint64_t benchSpiEndNs();
+
+#endif
@@ -0,0 +1,34 @@
+/**
+ * @file SPI.h
+ * @brief Shim do SPIClass do libmaple: dmaSendAsync alimenta o DMA simulado (BenchHost.h)
+ */
+
+#ifndef __BENCH_SPI_H__
+#define __BENCH_SPI_H__
+
+#include "Arduino.h"
+
+#define SPI_CLOCK_DIV2      0
+#define SPI_CLOCK_DIV4      1
+#define SPI_CLOCK_DIV8      2
+#define SPI_CLOCK_DIV16     3
+#define SPI_CLOCK_DIV32     4
+#define SPI_CLOCK_DIV64     5
+#define SPI_CLOCK_DIV128    6
+#define SPI_CLOCK_DIV256    7
+
+class SPIClass {
+public:
+    void begin() {}
+    void end() {}
+    void setClockDivider(uint32_t) {}
+
+    /**
+     * @brief Como no libmaple, espera a transferência anterior terminar e inicia a nova
+     */
+    uint8_t dmaSendAsync(const void* buffer, uint16_t length, bool minc = true);
+};
+
+extern SPIClass SPI;
+
+#endif
@@ -0,0 +1,33 @@
+// Shim do libmaple para o host (make bench): um DMA simulado por BenchHost.cpp
+
+#ifndef __BENCH_LIBMAPLE_DMA_H__
+#define __BENCH_LIBMAPLE_DMA_H__
+
+#include <stdint.h>
+
+struct dma_dev {};
+enum dma_channel { DMA_CH1 = 1, DMA_CH2, DMA_CH3, DMA_CH4, DMA_CH5, DMA_CH6, DMA_CH7 };
+struct dma_tube_reg_map { volatile uint32_t CCR, CNDTR, CPAR, CMAR; };
+
+extern dma_dev* DMA1;
+
+#define DMA_CCR_EN              (1 << 0)
+#define DMA_CCR_TCIE            (1 << 1)
+#define DMA_CCR_DIR_FROM_MEM    (1 << 4)
+#define DMA_CCR_MINC            (1 << 7)
+#define DMA_CCR_PSIZE_16BITS    (1 << 8)
+#define DMA_CCR_MSIZE_8BITS     (0 << 10)
+#define DMA_CCR_MSIZE_16BITS    (1 << 10)
+#define DMA_CCR_PL_HIGH         (2 << 12)
+#define DMA_ISR_TCIF            (1 << 1)
+
+void dma_init(dma_dev* dev);
+void dma_disable(dma_dev* dev, dma_channel channel);
+dma_tube_reg_map* dma_tube_regs(dma_dev* dev, dma_channel channel);
+void dma_clear_isr_bits(dma_dev* dev, dma_channel channel);
+// Os timers do LedController terminam na hora: a flag de fim está sempre ligada
+uint8_t dma_get_isr_bits(dma_dev* dev, dma_channel channel);
+// Bytes que o envio SPI em andamento ainda não leu (BenchHost.h)
+uint16_t dma_get_count(dma_dev* dev, dma_channel channel);
+
+#endif
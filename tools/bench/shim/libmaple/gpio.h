@@ -0,0 +1,16 @@
+// Shim do libmaple para o host (make bench): portas com registradores em RAM
+
+#ifndef __BENCH_LIBMAPLE_GPIO_H__
+#define __BENCH_LIBMAPLE_GPIO_H__
+
+#include <stdint.h>
+
+struct gpio_reg_map { volatile uint32_t CRL, CRH, IDR, ODR, BSRR, BRR, LCKR; };
+struct gpio_dev { gpio_reg_map* regs; };
+enum gpio_pin_mode { GPIO_OUTPUT_PP, GPIO_AF_OUTPUT_PP };
+
+extern gpio_dev *GPIOA, *GPIOB;
+
+static inline void gpio_set_mode(gpio_dev*, uint8_t, gpio_pin_mode) {}
+
+#endif
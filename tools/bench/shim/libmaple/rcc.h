@@ -0,0 +1,10 @@
+// Shim do libmaple para o host (make bench): clocks de periféricos não fazem nada
+
+#ifndef __BENCH_LIBMAPLE_RCC_H__
+#define __BENCH_LIBMAPLE_RCC_H__
+
+enum rcc_clk_id { RCC_AFIO, RCC_GPIOA, RCC_GPIOB, RCC_TIMER1, RCC_TIMER2, RCC_TIMER3, RCC_TIMER4, RCC_DMA1 };
+
+static inline void rcc_clk_enable(rcc_clk_id) {}
+
+#endif
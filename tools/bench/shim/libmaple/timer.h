@@ -0,0 +1,21 @@
+// Shim do libmaple para o host (make bench): timers com registradores em RAM
+
+#ifndef __BENCH_LIBMAPLE_TIMER_H__
+#define __BENCH_LIBMAPLE_TIMER_H__
+
+#include <stdint.h>
+
+struct timer_reg_map {
+    volatile uint32_t CR1, CR2, SMCR, DIER, SR, EGR, CCMR1, CCMR2, CCER, CNT, PSC, ARR, RCR,
+                      CCR1, CCR2, CCR3, CCR4, BDTR, DCR, DMAR;
+};
+struct timer_dev { union { timer_reg_map* gen; timer_reg_map* adv; } regs; };
+
+extern timer_dev *TIMER1, *TIMER2, *TIMER3, *TIMER4;
+
+#define TIMER_CR1_CEN   (1 << 0)
+#define TIMER_DIER_UDE  (1 << 8)
+
+static inline void timer_pause(timer_dev* dev) { dev->regs.gen->CR1 &= ~TIMER_CR1_CEN; }
+
+#endif
@@ -0,0 +1 @@
+// Shim do core para o host (make bench): vazio, incluído por WS2812B.cpp
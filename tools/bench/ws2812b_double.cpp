@@ -0,0 +1,6 @@
+// WS2812B com buffer duplo (o padrão), de lib/WS2812BLibmaple/WS2812B.cpp ligado ao benchmark
+
+#include <WS2812B.h>
+
+#define WS2812B_VARIANT ws2812bDouble
+#include "ws2812b_variant.inc"
@@ -0,0 +1,9 @@
+// WS2812B com buffer único: a biblioteca compilada de novo com WS2812B_SINGLE_BUFFER e a classe
+// renomeada, para conviver com a de buffer duplo no mesmo binário
+
+#define WS2812B_SINGLE_BUFFER 1
+#define WS2812B WS2812BSingle
+#include <WS2812B.cpp>
+
+#define WS2812B_VARIANT ws2812bSingle
+#include "ws2812b_variant.inc"
@@ -0,0 +1,35 @@
+/**
+ * @file ws2812b_variant.h
+ * @brief WS2812B real compilado com buffer duplo e com buffer único (make bench)
+ * @version 1.0
+ * @date 2026-10-18
+ * 
+ * O modo é escolhido em tempo de compilação (WS2812B_SINGLE_BUFFER), então a
+ * biblioteca é compilada duas vezes: ws2812b_double.cpp e ws2812b_single.cpp,
+ * com a classe renomeada no segundo. Cada um expõe as mesmas funções no seu
+ * namespace, com o laço de setPixelColor() dentro da própria unidade.
+ * 
+ * @copyright Copyright (c) 2026
+ */
+
+#ifndef __BENCH_WS2812B_VARIANT_H__
+#define __BENCH_WS2812B_VARIANT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define WS2812B_VARIANT_API(ns) \
+    namespace ns { \
+        /* Buffer de pixels mais a LUT */ \
+        size_t bytes(uint16_t n); \
+        /* Fita nova de n LEDs, enviada inteira a cada show() */ \
+        void setup(uint16_t n); \
+        /* setPixelColor() de todos os LEDs, rgb com 3 bytes por LED */ \
+        void write(const uint8_t* rgb, uint16_t n); \
+        void show(); \
+    }
+
+WS2812B_VARIANT_API(ws2812bDouble)
+WS2812B_VARIANT_API(ws2812bSingle)
+
+#endif
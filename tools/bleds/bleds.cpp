@@ -0,0 +1,194 @@
+/**
+ * @file bleds.cpp
+ * @brief Codificador no host dos frames bleds (comando com CRC e número de sequência)
+ * @version 1.0
+ * @date 2026-10-18
+ * 
+ * Empacota payloads de LEDs no frame que CommSimhub::readFramedLeds()
+ * aceita:
+ * 
+ *   (0xFF)x6 bleds (LEN MSB)(LEN LSB)(SEQ)(0x00) payload (CRC MSB)..(CRC LSB)
+ * 
+ * O CRC é o CRC-32/MPEG-2 (polinômio 0x04C11DB7, início 0xFFFFFFFF, sem
+ * reflexão e sem XOR final) sobre header e payload, em palavras de 32 bits
+ * big endian com a última completada com zeros, como na unidade CRC do
+ * STM32F1. Aqui ele é calculado bit a bit, independente do firmware, e
+ * --check o confere contra o caminho em software de src/comm/Crc32.
+ * 
+ * Uso: make bleds  (ou bleds --check | bleds [-s seq] <bytes> <entrada|-> <saida|->)
+ *   <bytes>  bytes de payload por frame (ex.: leds * 3 em RGB888, ver o comando ledfm)
+ *   -s seq   número de sequência do primeiro frame (padrão 0)
+ * 
+ * Cada bloco de <bytes> bytes da entrada vira um frame, com a sequência
+ * incrementada a cada frame.
+ * 
+ * @copyright Copyright (c) 2026
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include <comm/Crc32.h>
+
+#define BLEDS_PREAMBLE_BYTES    6
+#define BLEDS_COMMAND           "bleds"
+#define BLEDS_COMMAND_BYTES     5
+#define BLEDS_HEADER_BYTES      4       // LEDS_FRAME_HEADER_SIZE de CommSimhub.h
+#define BLEDS_CRC_BYTES         4       // LEDS_FRAME_CRC_SIZE
+#define BLEDS_MAX_PAYLOAD       0xFFFF
+
+// ==================== CRC de referência ====================
+
+/**
+ * @brief CRC-32/MPEG-2 bit a bit
+ * @param pad Completar com zeros até múltiplo de 4 bytes (o cálculo do frame)
+ */
+static uint32_t crcReference(const uint8_t* data, size_t length, bool pad, uint32_t crc = 0xFFFFFFFF)
+{
+    size_t total = pad ? (length + 3) & ~(size_t)3 : length;
+    for (size_t i = 0; i < total; i++) {
+        crc ^= (uint32_t)(i < length ? data[i] : 0) << 24;
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04C11DB7 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+// ==================== Frame ====================
+
+/**
+ * @brief Monta o frame bleds completo de um payload
+ */
+static void buildFrame(std::vector<uint8_t>& frame, const uint8_t* payload, uint16_t length, uint8_t seq)
+{
+    frame.assign(BLEDS_PREAMBLE_BYTES, 0xFF);
+    frame.insert(frame.end(), BLEDS_COMMAND, BLEDS_COMMAND + BLEDS_COMMAND_BYTES);
+
+    size_t body = frame.size();
+    uint8_t header[BLEDS_HEADER_BYTES] = { (uint8_t)(length >> 8), (uint8_t)length, seq, 0 };
+    frame.insert(frame.end(), header, header + sizeof(header));
+    frame.insert(frame.end(), payload, payload + length);
+
+    // O header tem 4 bytes: header e payload formam um só fluxo de palavras
+    uint32_t crc = crcReference(&frame[body], frame.size() - body, true);
+    for (int shift = 24; shift >= 0; shift -= 8) frame.push_back((uint8_t)(crc >> shift));
+}
+
+// ==================== Conferência ====================
+
+static int failures = 0;
+
+static void expect(bool ok, const char* what, size_t length)
+{
+    if (!ok) {
+        fprintf(stderr, "FAIL %s (%zu bytes)\n", what, length);
+        failures++;
+    }
+}
+
+/**
+ * @brief Confere a referência e o frame contra o Crc32 do firmware
+ */
+static int check()
+{
+    // Valor de verificação do catálogo de CRCs ("123456789", sem completar)
+    const uint8_t catalog[] = "123456789";
+    expect(crcReference(catalog, 9, false) == 0x0376E6E7, "CRC-32/MPEG-2 check value", 9);
+
+    srand(1234);
+    std::vector<uint8_t> payload, frame;
+    for (size_t length = 0; length <= 3 * 512; length++) {
+        payload.resize(length);
+        for (size_t i = 0; i < length; i++) payload[i] = rand();
+        uint8_t seq = rand();
+        buildFrame(frame, payload.data(), length, seq);
+
+        // Como readFramedLeds(): header e payload em duas chamadas
+        const uint8_t* header = &frame[BLEDS_PREAMBLE_BYTES + BLEDS_COMMAND_BYTES];
+        Crc32::reset();
+        Crc32::update(header, BLEDS_HEADER_BYTES);
+        Crc32::update(payload.data(), length);
+        const uint8_t* crc = header + BLEDS_HEADER_BYTES + length;
+        uint32_t received = ((uint32_t)crc[0] << 24) | ((uint32_t)crc[1] << 16) | ((uint32_t)crc[2] << 8) | crc[3];
+        expect(Crc32::value() == received, "frame CRC differs from Crc32", length);
+
+        // Em palavras inteiras o fluxo pode ser dividido em qualquer ponto múltiplo de 4
+        size_t split = (length / 2) & ~(size_t)3;
+        Crc32::reset();
+        Crc32::update(header, BLEDS_HEADER_BYTES);
+        Crc32::update(payload.data(), split);
+        Crc32::update(payload.data() + split, length - split);
+        expect(Crc32::value() == received, "split update differs", length);
+
+        expect(frame.size() == BLEDS_PREAMBLE_BYTES + BLEDS_COMMAND_BYTES + BLEDS_HEADER_BYTES + length + BLEDS_CRC_BYTES,
+               "frame size", length);
+        expect(header[0] == (length >> 8) && header[1] == (length & 0xFF) && header[2] == seq && header[3] == 0,
+               "frame header", length);
+    }
+
+    // Um bit trocado no payload tem que mudar o CRC
+    payload.assign(246, 0x5A);
+    buildFrame(frame, payload.data(), payload.size(), 0);
+    uint32_t good = crcReference(&frame[BLEDS_PREAMBLE_BYTES + BLEDS_COMMAND_BYTES], BLEDS_HEADER_BYTES + payload.size(), true);
+    frame[BLEDS_PREAMBLE_BYTES + BLEDS_COMMAND_BYTES + BLEDS_HEADER_BYTES + 100] ^= 0x08;
+    expect(crcReference(&frame[BLEDS_PREAMBLE_BYTES + BLEDS_COMMAND_BYTES], BLEDS_HEADER_BYTES + payload.size(), true) != good,
+           "flipped bit not detected", payload.size());
+
+    if (failures) {
+        fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+    printf("bleds: reference CRC matches Crc32 for payloads of 0 to %u bytes\n", 3 * 512);
+    return 0;
+}
+
+// ==================== Codificação ====================
+
+static void usage()
+{
+    fprintf(stderr, "uso: bleds --check | bleds [-s seq] <bytes> <entrada|-> <saida|->\n");
+    exit(2);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc == 2 && strcmp(argv[1], "--check") == 0) return check();
+
+    uint8_t seq = 0;
+    int arg = 1;
+    if (arg + 1 < argc && strcmp(argv[arg], "-s") == 0) {
+        seq = (uint8_t)atoi(argv[arg + 1]);
+        arg += 2;
+    }
+    if (argc - arg != 3) usage();
+
+    long bytes = atol(argv[arg]);
+    if (bytes <= 0 || bytes > BLEDS_MAX_PAYLOAD) {
+        fprintf(stderr, "bytes must be 1..%d\n", BLEDS_MAX_PAYLOAD);
+        return 2;
+    }
+
+    FILE* in = strcmp(argv[arg + 1], "-") == 0 ? stdin : fopen(argv[arg + 1], "rb");
+    FILE* out = strcmp(argv[arg + 2], "-") == 0 ? stdout : fopen(argv[arg + 2], "wb");
+    if (!in || !out) {
+        fprintf(stderr, "cannot open %s\n", !in ? argv[arg + 1] : argv[arg + 2]);
+        return 1;
+    }
+
+    std::vector<uint8_t> payload(bytes), frame;
+    unsigned frames = 0;
+    while (fread(payload.data(), 1, payload.size(), in) == payload.size()) {
+        buildFrame(frame, payload.data(), payload.size(), seq++);
+        fwrite(frame.data(), 1, frame.size(), out);
+        frames++;
+    }
+    fprintf(stderr, "bleds: %u frames of %ld bytes\n", frames, bytes);
+
+    if (in != stdin) fclose(in);
+    if (out != stdout) fclose(out);
+    return 0;
+}
@@ -0,0 +1,187 @@
+/**
+ * @file led_test.cpp
+ * @brief Teste no host do buffer DMA do LedController após envios de prefixo
+ * @version 1.0
+ * @date 2026-10-18
+ *
+ * Um show() que envia só o prefixo alterado escreve os zeros do reset logo
+ * depois dele, sobre a codificação dos LEDs seguintes. O buffer DMA precisa
+ * voltar a ser o frame inteiro, porque showEncoded() sem argumentos o envia
+ * como está. Cada caso faz show() de prefixo, writeEncoded() e
+ * showEncoded(), e compara o buffer com o de uma fita de referência que
+ * codificou as mesmas cores por inteiro. Os casos rodam com e sem o bitmap de
+ * LEDs sujos, que troca _encodePixels() por _encodeDirty().
+ *
+ * Compilado sobre o shim do core em tools/bench/shim (DMA termina na hora).
+ *
+ * Uso: make led-test
+ *
+ * @copyright Copyright (c) 2026
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+#include <LedController.h>
+
+#include "BenchHost.h"
+
+#define LED_TEST_LEDS       16
+#define LED_TEST_SLOTS      (BYTES_PER_LED_RGB * BITS_PER_BYTE)
+
+static int failures = 0;
+
+#define CHECK(cond) do { \
+    if (!(cond)) { printf("FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } \
+} while (0)
+
+static bool useDirtyBits = false;
+
+/**
+ * @brief LedController com bitmap de LEDs sujos, como o StaticLedController
+ */
+class DirtyLedController : public LedController {
+public:
+    DirtyLedController(uint8_t* pixelBuffer, uint16_t* dmaBuffer, uint32_t* dirtyBits)
+        : LedController(LED_TEST_LEDS, pixelBuffer, dmaBuffer)
+    {
+        _setDirtyBits(dirtyBits);
+    }
+};
+
+/**
+ * @brief Fita com os buffers do teste, para ler o buffer DMA
+ */
+struct Strip {
+    std::vector<uint8_t> pixels;
+    std::vector<uint16_t> dma;
+    std::vector<uint32_t> dirty;
+    LedController* controller;
+
+    Strip()
+        : pixels(LED_CONTROLLER_PIXEL_BUFFER_SIZE(LED_TEST_LEDS, BYTES_PER_LED_RGB), 0),
+          dma(LED_CONTROLLER_DMA_BUFFER_SIZE(LED_TEST_LEDS, BYTES_PER_LED_RGB), 0),
+          dirty(LED_CONTROLLER_DIRTY_WORDS(LED_TEST_LEDS), 0)
+    {
+        if (useDirtyBits) {
+            controller = new DirtyLedController(pixels.data(), dma.data(), dirty.data());
+        } else {
+            controller = new LedController(LED_TEST_LEDS, pixels.data(), dma.data());
+        }
+        controller->begin();
+    }
+    ~Strip() { delete controller; }
+
+    void show()
+    {
+        while (!controller->canShow()) benchSkipUs(100);
+        controller->show();
+    }
+};
+
+static uint8_t colorOf(uint16_t led, uint8_t channel, uint8_t frame)
+{
+    return (uint8_t)(led * 37 + channel * 71 + frame * 13 + 1);
+}
+
+static void setLeds(LedController* controller, uint16_t first, uint16_t end, uint8_t frame)
+{
+    for (uint16_t i = first; i < end; i++) {
+        controller->setPixelColor(i, colorOf(i, 0, frame), colorOf(i, 1, frame), colorOf(i, 2, frame));
+    }
+}
+
+/**
+ * @brief Prefixo de prefix LEDs, depois os LEDs [first, first + count) copiados de outro frame
+ */
+static void testPrefixThenEncoded(uint16_t prefix, uint16_t first, uint16_t count)
+{
+    Strip strip;
+    setLeds(strip.controller, 0, LED_TEST_LEDS, 0);
+    strip.show();
+    CHECK(strip.controller->getLastSentCount() == LED_TEST_LEDS);
+
+    // Só o prefixo muda: o reset é escrito sobre os LEDs a partir de prefix
+    setLeds(strip.controller, 0, prefix, 1);
+    strip.show();
+    CHECK(strip.controller->getLastSentCount() == prefix);
+
+    // Referência: as mesmas cores e o trecho do frame 2, codificados por inteiro
+    Strip reference;
+    reference.controller->setFullRefreshInterval(0);
+    setLeds(reference.controller, 0, prefix, 1);
+    setLeds(reference.controller, prefix, LED_TEST_LEDS, 0);
+    setLeds(reference.controller, first, first + count, 2);
+    reference.show();
+
+    Strip other;
+    other.controller->setFullRefreshInterval(0);
+    setLeds(other.controller, 0, LED_TEST_LEDS, 2);
+    other.show();
+
+    strip.controller->writeEncoded(first, other.dma.data() + first * LED_TEST_SLOTS, count);
+    strip.controller->showEncoded();
+
+    size_t frameSlots = (size_t)LED_TEST_LEDS * LED_TEST_SLOTS;
+    size_t firstBad = frameSlots;
+    for (size_t i = 0; i < frameSlots && firstBad == frameSlots; i++) {
+        if (strip.dma[i] != reference.dma[i]) firstBad = i;
+    }
+    if (firstBad != frameSlots) {
+        printf("%s, prefix %u, encoded [%u, %u): LED %zu differs from the full encoding\n",
+               useDirtyBits ? "dirty" : "full", prefix, first, first + count, firstBad / LED_TEST_SLOTS);
+    }
+    CHECK(firstBad == frameSlots);
+
+    // O reset do fim continua zerado
+    bool resetZero = true;
+    for (size_t i = frameSlots; i < strip.dma.size(); i++) resetZero = resetZero && strip.dma[i] == 0;
+    CHECK(resetZero);
+}
+
+/**
+ * @brief Vários prefixos seguidos, o último mais curto que os anteriores, antes do showEncoded()
+ */
+static void testShrinkingPrefixes()
+{
+    Strip strip;
+    setLeds(strip.controller, 0, LED_TEST_LEDS, 0);
+    strip.show();
+
+    for (uint16_t prefix = LED_TEST_LEDS - 1; prefix >= 1; prefix -= 3) {
+        setLeds(strip.controller, 0, prefix, (uint8_t)prefix);
+        strip.show();
+    }
+
+    Strip reference;
+    reference.controller->setFullRefreshInterval(0);
+    setLeds(reference.controller, 0, LED_TEST_LEDS, 0);
+    for (uint16_t prefix = LED_TEST_LEDS - 1; prefix >= 1; prefix -= 3) {
+        setLeds(reference.controller, 0, prefix, (uint8_t)prefix);
+    }
+    reference.show();
+
+    strip.controller->showEncoded();
+    CHECK(memcmp(strip.dma.data(), reference.dma.data(), strip.dma.size() * sizeof(uint16_t)) == 0);
+}
+
+int main()
+{
+    for (int dirty = 0; dirty < 2; dirty++) {
+        useDirtyBits = dirty != 0;
+        testPrefixThenEncoded(1, 10, 2);
+        testPrefixThenEncoded(4, 12, 4);
+        testPrefixThenEncoded(LED_TEST_LEDS / 2, 0, 2);
+        testPrefixThenEncoded(LED_TEST_LEDS - 1, 3, 1);
+        testShrinkingPrefixes();
+    }
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}